@@ -17,11 +17,19 @@
 #ifndef NF_H
 #define NF_H
 
+#ifdef NF_INLINES_C
+#define NF_INLINE ANTIC_DLL
+#else
+#define NF_INLINE static __inline__
+#endif
+
 #include "gmp.h"
 #include "flint/flint.h"
 #include "flint/fmpz.h"
 #include "flint/fmpz_poly.h"
 #include "flint/fmpq_poly.h"
+#include "flint/fmpq_mat.h"
+#include "flint/nmod_poly.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -49,6 +57,24 @@
 
 long int antic_test_multiplier(void);
 
+typedef struct { /* image of the defining polynomial modulo a word sized n */
+   mp_limb_t n;      /* modulus */
+   nmod_poly_t pol;  /* num(pol) mod n, shorter than pol if n divides lead */
+   int precomp;      /* whether pinv and powers have been computed */
+   nmod_poly_t pinv; /* inverse of reverse of pol, zero length if not invertible */
+   mp_ptr * powers;  /* x^i mod pol for i < 2*deg - 1, or NULL if not invertible */
+} nf_nmod_struct;
+
+typedef struct {
+   nf_nmod_struct * entries; /* allocated on first use */
+   slong length;     /* number of entries in use */
+   slong next;       /* entry to be replaced next once the cache is full */
+   ulong hits;
+   ulong misses;
+} nf_nmod_cache_struct;
+
+#define NF_NMOD_CACHE_SIZE 16 /* maximum number of cached moduli */
+
 typedef struct {
    fmpq_poly_t pol;  /* defining polynomial */
    union {
@@ -61,11 +87,15 @@ typedef struct {
    } powers;
    fmpq_poly_t traces; /* S_k = sum_i \theta_i^k for k = 0, 1, 2, ..., (n-1) */
    ulong flag;       /* 1 = pol monic over ZZ, 2, = linear, 4 = quadratic field */
+   slong powers_cutoff; /* maximum length of pol where we precompute powers */
+   ulong precomp;    /* which of pinv, powers, traces and trace_form have been computed */
+   nf_nmod_cache_struct * nmod_cache; /* images of pol modulo word sized n */
+   fmpq_mat_t trace_form; /* Tr(theta^(i + j)) */
 } nf_struct;
 
 typedef nf_struct nf_t[1];
 
-#define NF_POWERS_CUTOFF 30 /* maximum length of pol where we precompute powers */
+#define NF_POWERS_CUTOFF 30 /* default maximum length of pol where we precompute powers */
 
 #define NF_GENERIC 0
 #define NF_MONIC 1
@@ -73,6 +103,41 @@ typedef nf_struct nf_t[1];
 #define NF_QUADRATIC 4
 #define NF_GAUSSIAN 8
 
+#define NF_PRECOMP_PINV 1
+#define NF_PRECOMP_POWERS 2
+#define NF_PRECOMP_TRACES 4
+#define NF_PRECOMP_TRACE_FORM 8
+#define NF_PRECOMP_DEFAULT 7 /* data computed by nf_init */
+#define NF_PRECOMP_ALL 15
+
+/* fixed prime and evaluation point for fingerprints */
+#if FLINT64
+#define NF_HASH_PRIME UWORD(18446744073709551557)
+#define NF_HASH_POINT UWORD(0x9e3779b97f4a7c15)
+#else
+#define NF_HASH_PRIME UWORD(4294967291)
+#define NF_HASH_POINT UWORD(0x9e3779b9)
+#endif
+
+typedef struct { /* source or sink of binary data, a file or a buffer */
+   FILE * file;         /* file, or NULL for a buffer */
+   unsigned char * buf; /* buffer, or NULL to only count bytes written */
+   slong size;          /* size of the buffer */
+   slong pos;           /* number of bytes read or written so far */
+   int error;           /* set on a failed read or write */
+} nf_bin_stream_struct;
+
+typedef nf_bin_stream_struct nf_bin_stream_t[1];
+
+#define NF_BIN_VERSION 1 /* version of the binary format */
+
+/* bytes allocated at a time when reading data of unverified length */
+#define NF_BIN_CHUNK 65536
+
+/* eight byte tags, including the terminating zero */
+#define NF_BIN_MAGIC_NF "ANTICNF"  /* number field */
+#define NF_BIN_MAGIC_VEC "ANTICNV" /* vector of number field elements */
+
 /******************************************************************************
 
     Initialisation
@@ -81,12 +146,130 @@ typedef nf_struct nf_t[1];
 
 ANTIC_DLL void nf_init(nf_t nf, const fmpq_poly_t pol);
 
+ANTIC_DLL void nf_init_flags(nf_t nf, const fmpq_poly_t pol, ulong flags);
+
 ANTIC_DLL void nf_init_randtest(nf_t nf, flint_rand_t state, slong len,  mp_bitcnt_t bits_in);
 
 ANTIC_DLL void nf_clear(nf_t nf);
 
 ANTIC_DLL void nf_print(const nf_t nf);
 
+/******************************************************************************
+
+    Precomputation
+
+******************************************************************************/
+
+ANTIC_DLL void _nf_precompute(nf_t nf, ulong flags);
+
+NF_INLINE
+void nf_precompute(nf_t nf, ulong flags)
+{
+   if ((nf->precomp & flags) != flags)
+      _nf_precompute(nf, flags);
+}
+
+/* whether products are reduced using the precomputed powers x^i mod pol */
+NF_INLINE
+int _nf_use_powers(const nf_t nf)
+{
+   return (nf->precomp & NF_PRECOMP_POWERS)
+       && nf->pol->length <= nf->powers_cutoff;
+}
+
+/* precomputed inverse of the leading coefficient of pol, or NULL */
+NF_INLINE
+const fmpz_preinvn_struct * _nf_pinv(const nf_t nf)
+{
+   return (nf->precomp & NF_PRECOMP_PINV) ? nf->pinv.qq : NULL;
+}
+
+ANTIC_DLL void _nf_traces(fmpz * num, fmpz_t den, const nf_t nf);
+
+ANTIC_DLL void _nf_trace_form(fmpq_mat_t res, const nf_t nf);
+
+ANTIC_DLL void _nf_powers_clear(nf_t nf);
+
+ANTIC_DLL void nf_set_powers_cutoff(nf_t nf, slong cutoff);
+
+/******************************************************************************
+
+    Modular images
+
+******************************************************************************/
+
+ANTIC_DLL void _nf_nmod_init(nf_nmod_struct * mod, const nf_t nf, mp_limb_t n);
+
+ANTIC_DLL void _nf_nmod_clear(nf_nmod_struct * mod);
+
+ANTIC_DLL nf_nmod_struct * nf_get_nmod(nf_t nf, mp_limb_t n);
+
+ANTIC_DLL void nf_nmod_precompute(nf_nmod_struct * mod, const nf_t nf);
+
+ANTIC_DLL void _nf_nmod_cache_clear(nf_nmod_cache_struct * cache);
+
+ANTIC_DLL void nf_nmod_rem(nmod_poly_t r, const nmod_poly_t a,
+                                         nf_nmod_struct * mod, const nf_t nf);
+
+NF_INLINE
+ulong nf_nmod_cache_hits(const nf_t nf)
+{
+   return nf->nmod_cache->hits;
+}
+
+NF_INLINE
+ulong nf_nmod_cache_misses(const nf_t nf)
+{
+   return nf->nmod_cache->misses;
+}
+
+/******************************************************************************
+
+    Binary serialisation
+
+******************************************************************************/
+
+NF_INLINE
+void nf_bin_stream_init_file(nf_bin_stream_t s, FILE * file)
+{
+   s->file = file;
+   s->buf = NULL;
+   s->size = 0;
+   s->pos = 0;
+   s->error = 0;
+}
+
+NF_INLINE
+void nf_bin_stream_init_buf(nf_bin_stream_t s, unsigned char * buf, slong size)
+{
+   s->file = NULL;
+   s->buf = buf;
+   s->size = size;
+   s->pos = 0;
+   s->error = 0;
+}
+
+ANTIC_DLL int _nf_bin_write(nf_bin_stream_t s,
+                                    const unsigned char * data, slong n);
+
+ANTIC_DLL int _nf_bin_read(unsigned char * data, nf_bin_stream_t s, slong n);
+
+ANTIC_DLL int _nf_bin_write_ui(nf_bin_stream_t s, ulong x);
+
+ANTIC_DLL int _nf_bin_read_ui(ulong * x, nf_bin_stream_t s);
+
+ANTIC_DLL int _nf_bin_write_fmpz(nf_bin_stream_t s, const fmpz_t x);
+
+ANTIC_DLL int _nf_bin_read_fmpz(fmpz_t x, nf_bin_stream_t s);
+
+ANTIC_DLL ulong _nf_hash(const fmpz * num, const fmpz_t den, slong len);
+
+ANTIC_DLL ulong nf_hash(const nf_t nf);
+
+ANTIC_DLL int nf_write_bin(nf_bin_stream_t s, const nf_t nf);
+
+ANTIC_DLL int nf_read_bin(fmpq_poly_t pol, nf_bin_stream_t s);
+
 #ifdef __cplusplus
 }
 #endif
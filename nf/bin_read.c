@@ -0,0 +1,33 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <string.h>
+#include "nf.h"
+
+int _nf_bin_read(unsigned char * data, nf_bin_stream_t s, slong n)
+{
+   if (s->error)
+      return 0;
+
+   if (s->file != NULL)
+   {
+      if (fread(data, 1, n, s->file) != (size_t) n)
+         s->error = 1;
+   } else if (s->buf == NULL || s->pos + n > s->size)
+      s->error = 1;
+   else
+      memcpy(data, s->buf + s->pos, n);
+
+   if (!s->error)
+      s->pos += n;
+
+   return !s->error;
+}
@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+int _nf_bin_read_fmpz(fmpz_t x, nf_bin_stream_t s)
+{
+   unsigned char b1[8], * b;
+   ulong p, u;
+   slong i, n;
+   int neg;
+
+   if (!_nf_bin_read_ui(&p, s))
+      return 0;
+
+   n = p >> 1;
+   neg = p & 1;
+
+   if (n == 0)
+   {
+      fmpz_zero(x);
+
+      return 1;
+   }
+
+   /* reject lengths which cannot be valid before allocating */
+   if (n > WORD_MAX/16 || (s->file == NULL && 8*n > s->size - s->pos))
+   {
+      s->error = 1;
+      return 0;
+   }
+
+   if (8*n <= FLINT_BITS/8)
+   {
+      if (!_nf_bin_read(b1, s, 8))
+         return 0;
+
+      u = 0;
+      for (i = 7; i >= 0; i--)
+         u = (u << 8) | b1[i];
+
+      fmpz_set_ui(x, u);
+   } else
+   {
+      mpz_ptr z;
+      slong len, alloc;
+
+      /*
+         a file can only be checked by reading, so grow the buffer as the
+         data arrives rather than trusting a possibly corrupt length
+      */
+      alloc = FLINT_MIN(8*n, NF_BIN_CHUNK);
+      b = (unsigned char *) flint_malloc(alloc);
+
+      for (len = 0; len < 8*n; len = alloc)
+      {
+         if (len == alloc)
+         {
+            alloc = FLINT_MIN(8*n, 2*alloc);
+            b = (unsigned char *) flint_realloc(b, alloc);
+         }
+
+         if (!_nf_bin_read(b + len, s, alloc - len))
+         {
+            flint_free(b);
+            return 0;
+         }
+      }
+
+      z = _fmpz_promote(x);
+      mpz_import(z, 8*n, -1, 1, 0, 0, b);
+      _fmpz_demote_val(x);
+
+      flint_free(b);
+   }
+
+   if (neg)
+      fmpz_neg(x, x);
+
+   return 1;
+}
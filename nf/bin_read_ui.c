@@ -0,0 +1,37 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+int _nf_bin_read_ui(ulong * x, nf_bin_stream_t s)
+{
+   unsigned char b[8];
+   slong i;
+
+   if (!_nf_bin_read(b, s, 8))
+      return 0;
+
+   /* values which do not fit in a word are an error */
+   for (i = FLINT_BITS/8; i < 8; i++)
+   {
+      if (b[i] != 0)
+      {
+         s->error = 1;
+         return 0;
+      }
+   }
+
+   *x = 0;
+   for (i = FLINT_BITS/8 - 1; i >= 0; i--)
+      *x = (*x << 8) | b[i];
+
+   return 1;
+}
@@ -0,0 +1,36 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <string.h>
+#include "nf.h"
+
+int _nf_bin_write(nf_bin_stream_t s, const unsigned char * data, slong n)
+{
+   if (s->error)
+      return 0;
+
+   if (s->file != NULL)
+   {
+      if (fwrite(data, 1, n, s->file) != (size_t) n)
+         s->error = 1;
+   } else if (s->buf != NULL)
+   {
+      /* keep counting, so that the required size is known on failure */
+      if (s->pos + n > s->size)
+         s->error = 1;
+      else
+         memcpy(s->buf + s->pos, data, n);
+   }
+
+   s->pos += n;
+
+   return !s->error;
+}
@@ -0,0 +1,52 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+/*
+   An integer is written as a word 2*n + s, where s = 1 if it is negative,
+   followed by its absolute value as n eight byte limbs, least significant
+   first.
+*/
+int _nf_bin_write_fmpz(nf_bin_stream_t s, const fmpz_t x)
+{
+   if (!COEFF_IS_MPZ(*x))
+   {
+      const slong v = *x;
+
+      if (v == 0)
+         return _nf_bin_write_ui(s, 0);
+
+      _nf_bin_write_ui(s, 2 + (v < 0));
+
+      return _nf_bin_write_ui(s, FLINT_ABS(v));
+   } else
+   {
+      const mpz_ptr z = COEFF_TO_PTR(*x);
+      unsigned char * b;
+      size_t count;
+      slong n;
+      int res;
+
+      n = (mpz_sizeinbase(z, 2) + 63)/64;
+
+      b = (unsigned char *) flint_calloc(8*n, 1);
+
+      mpz_export(b, &count, -1, 1, 0, 0, z);
+
+      _nf_bin_write_ui(s, 2*n + (mpz_sgn(z) < 0));
+      res = _nf_bin_write(s, b, 8*n);
+
+      flint_free(b);
+
+      return res;
+   }
+}
@@ -0,0 +1,27 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+/* eight bytes, least significant first */
+int _nf_bin_write_ui(nf_bin_stream_t s, ulong x)
+{
+   unsigned char b[8];
+   slong i;
+
+   for (i = 0; i < 8; i++)
+   {
+      b[i] = (unsigned char) (x & 255);
+      x >>= 8;
+   }
+
+   return _nf_bin_write(s, b, 8);
+}
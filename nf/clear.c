@@ -19,19 +19,21 @@
 
 void nf_clear(nf_t nf)
 {
-    fmpq_poly_clear(nf->pol);
-
-    if (!(nf->flag & NF_MONIC))
+    if ((nf->precomp & NF_PRECOMP_PINV) && !(nf->flag & NF_MONIC))
        fmpz_preinvn_clear(nf->pinv.qq);
 
-    if (nf->pol->length <= NF_POWERS_CUTOFF && nf->pol->length > 3)
-    {
-       if (nf->flag & NF_MONIC)
-          _fmpz_poly_powers_clear(nf->powers.zz->powers, nf->powers.zz->len);
-       else
-          _fmpq_poly_powers_clear(nf->powers.qq->powers, nf->powers.qq->len);
-    }
+    if (nf->precomp & NF_PRECOMP_POWERS)
+       _nf_powers_clear(nf);
+
+    if (nf->precomp & NF_PRECOMP_TRACES)
+       fmpq_poly_clear(nf->traces);
 
-    fmpq_poly_clear(nf->traces);
+    if (nf->precomp & NF_PRECOMP_TRACE_FORM)
+       fmpq_mat_clear(nf->trace_form);
+
+    _nf_nmod_cache_clear(nf->nmod_cache);
+    flint_free(nf->nmod_cache);
+
+    fmpq_poly_clear(nf->pol);
 }
 
@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+nf_nmod_struct * nf_get_nmod(nf_t nf, mp_limb_t n)
+{
+   nf_nmod_cache_struct * cache = nf->nmod_cache;
+   nf_nmod_struct * mod;
+   slong i;
+
+   for (i = 0; i < cache->length; i++)
+   {
+      if (cache->entries[i].n == n)
+      {
+         cache->hits++;
+         return cache->entries + i;
+      }
+   }
+
+   cache->misses++;
+
+   if (cache->entries == NULL)
+      cache->entries = flint_malloc(NF_NMOD_CACHE_SIZE*sizeof(nf_nmod_struct));
+
+   if (cache->length < NF_NMOD_CACHE_SIZE)
+      mod = cache->entries + cache->length++;
+   else /* replace entries round robin */
+   {
+      mod = cache->entries + cache->next;
+      cache->next = (cache->next + 1) % NF_NMOD_CACHE_SIZE;
+
+      _nf_nmod_clear(mod);
+   }
+
+   _nf_nmod_init(mod, nf, n);
+
+   return mod;
+}
@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+ulong _nf_hash(const fmpz * num, const fmpz_t den, slong len)
+{
+   const mp_limb_t p = NF_HASH_PRIME;
+   mp_limb_t h, pinv;
+   slong i;
+
+   pinv = n_preinvert_limb(p);
+
+   /* Horner evaluation of len, num[0], ..., num[len - 1], den */
+   h = n_mod2_preinv(len, p, pinv);
+
+   for (i = 0; i < len; i++)
+   {
+      h = n_mulmod2_preinv(h, NF_HASH_POINT, p, pinv);
+      h = n_addmod(h, fmpz_fdiv_ui(num + i, p), p);
+   }
+
+   h = n_mulmod2_preinv(h, NF_HASH_POINT, p, pinv);
+   h = n_addmod(h, fmpz_fdiv_ui(den, p), p);
+
+   return h;
+}
+
+ulong nf_hash(const nf_t nf)
+{
+   return _nf_hash(fmpq_poly_numref(nf->pol), fmpq_poly_denref(nf->pol),
+                                                            nf->pol->length);
+}
@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void nf_init_flags(nf_t nf, const fmpq_poly_t pol, ulong flags)
+{
+    slong len = pol->length;
+
+    fmpz * lead = fmpq_poly_numref(pol) + len - 1;
+
+    if (len < 2)
+    {
+       flint_printf("Exception (nf_init_flags). Degree must be at least 1.\n");
+       abort();
+    }
+
+    fmpq_poly_init(nf->pol);
+    fmpq_poly_set(nf->pol, pol);
+
+    if (fmpz_is_one(fmpq_poly_denref(pol)) /* denominator is one and numerator is monic */
+     && fmpz_is_one(lead))
+       nf->flag = NF_MONIC;
+    else
+       nf->flag = NF_GENERIC;
+
+    if (len == 2) /* linear case */
+       nf->flag |= NF_LINEAR;
+    else if (len == 3) /* quadratic case */
+    {
+       nf->flag |= NF_QUADRATIC;
+       if (fmpz_is_one(pol->coeffs + 0) && fmpz_is_zero(pol->coeffs + 1) &&
+            fmpz_is_one(pol->coeffs + 2) && fmpz_is_one(pol->den))
+          nf->flag |= NF_GAUSSIAN;
+    }
+
+    /**** Inverse of leading coefficient, powers and traces on demand ****/
+
+    nf->powers_cutoff = NF_POWERS_CUTOFF;
+    nf->precomp = 0;
+
+    _nf_precompute(nf, flags);
+
+    /**** Modular images of f(x) are cached by nf_get_nmod ****/
+
+    nf->nmod_cache = flint_malloc(sizeof(nf_nmod_cache_struct));
+    nf->nmod_cache->entries = NULL;
+    nf->nmod_cache->length = 0;
+    nf->nmod_cache->next = 0;
+    nf->nmod_cache->hits = 0;
+    nf->nmod_cache->misses = 0;
+}
@@ -0,0 +1,27 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void _nf_nmod_cache_clear(nf_nmod_cache_struct * cache)
+{
+   slong i;
+
+   for (i = 0; i < cache->length; i++)
+      _nf_nmod_clear(cache->entries + i);
+
+   if (cache->entries != NULL)
+      flint_free(cache->entries);
+
+   cache->entries = NULL;
+   cache->length = 0;
+   cache->next = 0;
+}
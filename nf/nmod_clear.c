@@ -0,0 +1,29 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/nmod_vec.h"
+#include "nf.h"
+
+void _nf_nmod_clear(nf_nmod_struct * mod)
+{
+   slong i;
+
+   if (mod->powers != NULL)
+   {
+      for (i = 0; i < 2*mod->pol->length - 3; i++)
+         _nmod_vec_clear(mod->powers[i]);
+
+      flint_free(mod->powers);
+   }
+
+   nmod_poly_clear(mod->pol);
+   nmod_poly_clear(mod->pinv);
+}
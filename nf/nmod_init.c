@@ -0,0 +1,32 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void _nf_nmod_init(nf_nmod_struct * mod, const nf_t nf, mp_limb_t n)
+{
+   const slong len = nf->pol->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   slong i;
+
+   mod->n = n;
+   mod->precomp = 0;
+   mod->powers = NULL;
+
+   nmod_poly_init(mod->pol, n);
+   nmod_poly_init(mod->pinv, n);
+
+   nmod_poly_fit_length(mod->pol, len);
+   for (i = 0; i < len; i++)
+      mod->pol->coeffs[i] = fmpz_fdiv_ui(fnum + i, n);
+   _nmod_poly_set_length(mod->pol, len);
+   _nmod_poly_normalise(mod->pol);
+}
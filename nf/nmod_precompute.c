@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/nmod_vec.h"
+#include "nf.h"
+
+void nf_nmod_precompute(nf_nmod_struct * mod, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   const nmod_t m = mod->pol->mod;
+   mp_limb_t linv, top;
+   mp_ptr prev;
+   slong i, j;
+
+   if (mod->precomp)
+      return;
+
+   mod->precomp = 1;
+
+   if (mod->pol->length != len || n_gcd(mod->pol->coeffs[len - 1], mod->n) != 1)
+      return;
+
+   linv = n_invmod(mod->pol->coeffs[len - 1], mod->n);
+
+   nmod_poly_reverse(mod->pinv, mod->pol, len);
+   nmod_poly_inv_series_newton(mod->pinv, mod->pinv, len);
+
+   /* x^i for i < deg, then x^i = x*x^(i - 1) reduced by f */
+   mod->powers = flint_malloc((2*len - 3)*sizeof(mp_ptr));
+
+   for (i = 0; i < 2*len - 3; i++)
+   {
+      mod->powers[i] = _nmod_vec_init(len - 1);
+
+      if (i < len - 1)
+      {
+         _nmod_vec_zero(mod->powers[i], len - 1);
+         mod->powers[i][i] = 1;
+      } else
+      {
+         prev = mod->powers[i - 1];
+         top = nmod_mul(prev[len - 2], linv, m);
+
+         mod->powers[i][0] = 0;
+         for (j = 1; j < len - 1; j++)
+            mod->powers[i][j] = prev[j - 1];
+
+         _nmod_vec_scalar_addmul_nmod(mod->powers[i], mod->pol->coeffs,
+                                              len - 1, nmod_neg(top, m), m);
+      }
+   }
+}
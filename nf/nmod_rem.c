@@ -0,0 +1,52 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/nmod_vec.h"
+#include "nf.h"
+
+void nf_nmod_rem(nmod_poly_t r, const nmod_poly_t a,
+                                          nf_nmod_struct * mod, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   const slong alen = a->length;
+   slong i;
+
+   nf_nmod_precompute(mod, nf);
+
+   if (mod->powers == NULL)
+   {
+      flint_printf("Exception (nf_nmod_rem). Leading coefficient of defining\n");
+      flint_printf("polynomial not invertible modulo n.\n");
+      abort();
+   }
+
+   if (alen < len)
+      nmod_poly_set(r, a);
+   else if (alen <= 2*len - 3)
+   {
+      /* the coefficients of x^i for i >= deg are only read, so r may be a */
+      nmod_poly_fit_length(r, len - 1);
+
+      if (r != a)
+         _nmod_vec_set(r->coeffs, a->coeffs, len - 1);
+
+      for (i = len - 1; i < alen; i++)
+      {
+         if (a->coeffs[i] != 0)
+            _nmod_vec_scalar_addmul_nmod(r->coeffs, mod->powers[i],
+                                          len - 1, a->coeffs[i], mod->pol->mod);
+      }
+
+      _nmod_poly_set_length(r, len - 1);
+      _nmod_poly_normalise(r);
+   } else
+      nmod_poly_rem(r, a, mod->pol);
+}
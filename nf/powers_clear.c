@@ -0,0 +1,27 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void _nf_powers_clear(nf_t nf)
+{
+   const slong len = nf->pol->length;
+
+   if (len > 3 && len <= nf->powers_cutoff)
+   {
+      if (nf->flag & NF_MONIC)
+         _fmpz_poly_powers_clear(nf->powers.zz->powers, nf->powers.zz->len);
+      else
+         _fmpq_poly_powers_clear(nf->powers.qq->powers, nf->powers.qq->len);
+   }
+
+   nf->precomp &= ~NF_PRECOMP_POWERS;
+}
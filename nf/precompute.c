@@ -0,0 +1,72 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void _nf_precompute(nf_t nf, ulong flags)
+{
+   const fmpq_poly_struct * pol = nf->pol;
+   slong len = pol->length, deg = len - 1;
+
+   fmpz * lead = fmpq_poly_numref(pol) + len - 1;
+
+   flags &= NF_PRECOMP_ALL & ~nf->precomp;
+
+   /**** Set up precomputed inverse of leading coeff of f(x) ****/
+
+   if (flags & NF_PRECOMP_PINV)
+   {
+      if (!(nf->flag & NF_MONIC))
+         fmpz_preinvn_init(nf->pinv.qq, lead);
+   }
+
+   /**** Set up precomputed powers x^i mod f(x) ****/
+
+   if (flags & NF_PRECOMP_POWERS)
+   {
+      if (len > 3 && len <= nf->powers_cutoff) /* compute powers of generator mod pol */
+      {
+         if (nf->flag & NF_MONIC)
+         {
+            nf->powers.zz->powers = _fmpz_poly_powers_precompute(fmpq_poly_numref(pol), 
+                                         len);
+            nf->powers.zz->len = len;
+         }
+         else
+         {
+            nf->powers.qq->powers = _fmpq_poly_powers_precompute(fmpq_poly_numref(pol), 
+                                         fmpq_poly_denref(pol), len);
+            nf->powers.qq->len = len;
+         }
+      }
+   }
+
+   /**** Set up precomputed traces S_k = \sum _i theta_i^k for roots theta_i of f(x) ****/
+
+   if (flags & NF_PRECOMP_TRACES)
+   {
+      fmpq_poly_init2(nf->traces, deg);
+      _nf_traces(fmpq_poly_numref(nf->traces), fmpq_poly_denref(nf->traces), nf);
+   }
+
+   /**** Set up precomputed trace form Tr(theta^(i + j)), using the traces ****/
+
+   if (flags & NF_PRECOMP_TRACE_FORM)
+   {
+      /* make traces computed above available to _nf_trace_form */
+      nf->precomp |= (flags & NF_PRECOMP_TRACES);
+
+      fmpq_mat_init(nf->trace_form, deg, deg);
+      _nf_trace_form(nf->trace_form, nf);
+   }
+
+   nf->precomp |= flags;
+}
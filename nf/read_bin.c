@@ -0,0 +1,64 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <string.h>
+#include "nf.h"
+
+int nf_read_bin(fmpq_poly_t pol, nf_bin_stream_t s)
+{
+   unsigned char magic[8];
+   ulong version, h, len;
+   slong i;
+
+   if (!_nf_bin_read(magic, s, 8) || !_nf_bin_read_ui(&version, s)
+    || !_nf_bin_read_ui(&h, s) || !_nf_bin_read_ui(&len, s))
+      return 0;
+
+   /* each coefficient takes at least eight bytes */
+   if (memcmp(magic, NF_BIN_MAGIC_NF, 8) != 0 || version > NF_BIN_VERSION
+    || len < 2 || len > WORD_MAX/16
+    || (s->file == NULL && 8*len > s->size - s->pos))
+   {
+      s->error = 1;
+      return 0;
+   }
+
+   fmpq_poly_zero(pol);
+
+   _nf_bin_read_fmpz(fmpq_poly_denref(pol), s);
+
+   /* grow the polynomial as coefficients arrive, the length may be corrupt */
+   for (i = 0; i < len && !s->error; i++)
+   {
+      if (i == pol->alloc)
+         fmpq_poly_fit_length(pol, FLINT_MIN(len, FLINT_MAX(2*i, NF_BIN_CHUNK/8)));
+
+      _nf_bin_read_fmpz(fmpq_poly_numref(pol) + i, s);
+   }
+
+   /* on failure this covers every coefficient read, so they are cleared */
+   _fmpq_poly_set_length(pol, i);
+
+   /*
+      the polynomial must be canonical, as nf_write_bin writes it, and the
+      hash also detects a corrupted polynomial
+   */
+   if (s->error
+    || !_fmpq_poly_is_canonical(fmpq_poly_numref(pol), fmpq_poly_denref(pol), len)
+    || _nf_hash(fmpq_poly_numref(pol), fmpq_poly_denref(pol), len) != h)
+   {
+      fmpq_poly_zero(pol);
+      s->error = 1;
+      return 0;
+   }
+
+   return 1;
+}
@@ -0,0 +1,23 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+void nf_set_powers_cutoff(nf_t nf, slong cutoff)
+{
+   if (nf->precomp & NF_PRECOMP_POWERS)
+   {
+      _nf_powers_clear(nf);
+      nf->powers_cutoff = cutoff;
+      _nf_precompute(nf, NF_PRECOMP_POWERS);
+   } else
+      nf->powers_cutoff = cutoff;
+}
@@ -0,0 +1,168 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i;
+    flint_rand_t state;
+
+    flint_printf("get_nmod....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* check the image of the defining polynomial and its inverse */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_nmod_struct * mod;
+        nmod_poly_t f, r;
+        mp_limb_t n;
+        slong k, len;
+        int result;
+
+        nf_init_randtest(nf, state, 40, 200);
+        len = nf->pol->length;
+
+        do {
+           n = n_randtest_not_zero(state);
+        } while (n == 1);
+
+        mod = nf_get_nmod(nf, n);
+
+        nmod_poly_init(f, n);
+        nmod_poly_init(r, n);
+
+        for (k = 0; k < len; k++)
+           nmod_poly_set_coeff_ui(f, k, fmpz_fdiv_ui(fmpq_poly_numref(nf->pol) + k, n));
+
+        result = (mod->n == n && nmod_poly_equal(f, mod->pol)
+                               && mod->powers == NULL);
+
+        nf_nmod_precompute(mod, nf);
+
+        if (result && mod->powers != NULL)
+        {
+           /* rev(f)*pinv = 1 mod x^len */
+           nmod_poly_reverse(r, f, len);
+           nmod_poly_mullow(r, r, mod->pinv, len);
+           result = nmod_poly_is_one(r);
+        } else if (result)
+           result = (f->length < len || n_gcd(f->coeffs[len - 1], n) != 1);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("n = %wu\n", n);
+           printf("f = "); fmpq_poly_print_pretty(nf->pol, "x"); printf("\n");
+           printf("mod->pol = "); nmod_poly_print(mod->pol); printf("\n");
+           printf("mod->pinv = "); nmod_poly_print(mod->pinv); printf("\n");
+           abort();
+        }
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(r);
+        nf_clear(nf);
+    }
+
+    /* check the cache counters and replacement of entries */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        const nf_nmod_struct * mod;
+        mp_limb_t p;
+        slong k;
+        int result;
+
+        nf_init_randtest(nf, state, 20, 200);
+
+        p = n_nextprime(UWORD(1) << (FLINT_BITS - 2), 0);
+
+        for (k = 0; k < NF_NMOD_CACHE_SIZE; k++)
+        {
+           nf_get_nmod(nf, p);
+           mod = nf_get_nmod(nf, p);
+           result = (mod->n == p);
+
+           p = n_nextprime(p, 0);
+        }
+
+        result = result && (nf_nmod_cache_hits(nf) == NF_NMOD_CACHE_SIZE
+                         && nf_nmod_cache_misses(nf) == NF_NMOD_CACHE_SIZE);
+
+        /* a new modulus replaces the oldest entry */
+        mod = nf_get_nmod(nf, p);
+        result = result && (mod->n == p
+                         && nf_nmod_cache_misses(nf) == NF_NMOD_CACHE_SIZE + 1
+                         && nf->nmod_cache->length == NF_NMOD_CACHE_SIZE);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("hits = %wu, misses = %wu\n",
+                   nf_nmod_cache_hits(nf), nf_nmod_cache_misses(nf));
+           abort();
+        }
+
+        nf_clear(nf);
+    }
+
+    /* functions taking the field as const do not use the cache */
+    for (i = 0; i < 10 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, b;
+        fmpq_t n;
+        fmpq_poly_t g;
+        int result;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+        fmpq_init(n);
+        fmpq_poly_init(g);
+
+        nf_elem_randtest_not_zero(a, state, 200, nf);
+
+        nf_elem_inv(b, a, nf);
+        nf_elem_norm(n, a, nf);
+        nf_elem_charpoly(g, a, nf);
+
+        result = (nf_nmod_cache_hits(nf) == 0 && nf_nmod_cache_misses(nf) == 0
+                                           && nf->nmod_cache->length == 0);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("hits = %wu, misses = %wu\n",
+                   nf_nmod_cache_hits(nf), nf_nmod_cache_misses(nf));
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+        fmpq_clear(n);
+        fmpq_poly_clear(g);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
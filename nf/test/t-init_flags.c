@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("init_flags....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare arithmetic with deferred and immediate precomputation */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf, nf2;
+        nf_elem_t a, b, c, c2;
+        fmpq_t t, t2;
+        ulong flags = n_randint(state, NF_PRECOMP_ALL + 1);
+
+        nf_init_randtest(nf, state, 40, 200);
+        nf_init_flags(nf2, nf->pol, flags);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+        nf_elem_init(c, nf);
+        nf_elem_init(c2, nf2);
+
+        fmpq_init(t);
+        fmpq_init(t2);
+
+        nf_elem_randtest(a, state, 200, nf);
+        nf_elem_randtest(b, state, 200, nf);
+
+        nf_elem_mul(c, a, b, nf);
+        nf_elem_mul(c2, a, b, nf2);
+
+        nf_elem_trace(t, c, nf);
+        nf_elem_trace(t2, c2, nf2);
+
+        /* arithmetic does not precompute anything */
+        result = (nf_elem_equal(c, c2, nf) && fmpq_equal(t, t2)
+               && nf2->precomp == flags);
+
+        nf_precompute(nf2, NF_PRECOMP_ALL);
+
+        nf_elem_mul(c2, a, b, nf2);
+        nf_elem_trace(t2, c2, nf2);
+
+        result = result && (nf_elem_equal(c, c2, nf) && fmpq_equal(t, t2)
+               && nf2->precomp == NF_PRECOMP_ALL);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("flags = %wu\n", flags);
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+           printf("c = "); nf_elem_print_pretty(c, nf, "x"); printf("\n");
+           printf("c2 = "); nf_elem_print_pretty(c2, nf2, "x"); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+        nf_elem_clear(c, nf);
+        nf_elem_clear(c2, nf2);
+
+        fmpq_clear(t);
+        fmpq_clear(t2);
+
+        nf_clear(nf);
+        nf_clear(nf2);
+    }
+
+    /* fields that are never used only need clearing */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf, nf2;
+
+        nf_init_randtest(nf, state, 40, 200);
+        nf_init_flags(nf2, nf->pol, 0);
+
+        result = (nf2->precomp == 0);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("precomp = %wu\n", nf2->precomp);
+           abort();
+        }
+
+        nf_clear(nf);
+        nf_clear(nf2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+
+int
+main(void)
+{
+    int i;
+    flint_rand_t state;
+
+    flint_printf("nmod_rem....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with nmod_poly_rem */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_nmod_struct * mod;
+        nmod_poly_t a, r1, r2;
+        mp_limb_t p;
+        slong len;
+
+        nf_init_randtest(nf, state, 40, 200);
+        len = nf->pol->length;
+
+        do {
+           p = n_randtest_prime(state, 0);
+           mod = nf_get_nmod(nf, p);
+           nf_nmod_precompute(mod, nf);
+        } while (mod->powers == NULL);
+
+        nmod_poly_init(a, p);
+        nmod_poly_init(r1, p);
+        nmod_poly_init(r2, p);
+
+        nmod_poly_randtest(a, state, n_randint(state, 3*len));
+
+        nf_nmod_rem(r1, a, mod, nf);
+        nmod_poly_rem(r2, a, mod->pol);
+
+        if (!nmod_poly_equal(r1, r2))
+        {
+           printf("FAIL:\n");
+           printf("a = "); nmod_poly_print(a); printf("\n");
+           printf("r1 = "); nmod_poly_print(r1); printf("\n");
+           printf("r2 = "); nmod_poly_print(r2); printf("\n");
+           abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(r1);
+        nmod_poly_clear(r2);
+        nf_clear(nf);
+    }
+
+    /* check aliasing */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_nmod_struct * mod;
+        nmod_poly_t a, r;
+        mp_limb_t p;
+        slong len;
+
+        nf_init_randtest(nf, state, 40, 200);
+        len = nf->pol->length;
+
+        do {
+           p = n_randtest_prime(state, 0);
+           mod = nf_get_nmod(nf, p);
+           nf_nmod_precompute(mod, nf);
+        } while (mod->powers == NULL);
+
+        nmod_poly_init(a, p);
+        nmod_poly_init(r, p);
+
+        nmod_poly_randtest(a, state, n_randint(state, 2*len - 2));
+
+        nf_nmod_rem(r, a, mod, nf);
+        nf_nmod_rem(a, a, mod, nf);
+
+        if (!nmod_poly_equal(r, a))
+        {
+           printf("FAIL:\n");
+           printf("a = "); nmod_poly_print(a); printf("\n");
+           printf("r = "); nmod_poly_print(r); printf("\n");
+           abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(r);
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
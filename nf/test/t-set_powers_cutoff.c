@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("set_powers_cutoff....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* products agree whatever the cutoff */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf, nf2;
+        nf_elem_t a, b, c, c2;
+        slong len;
+
+        nf_init_randtest(nf, state, 60, 100);
+        len = nf->pol->length;
+
+        if (n_randint(state, 2))
+           nf_init(nf2, nf->pol);
+        else
+           nf_init_flags(nf2, nf->pol, 0);
+
+        /* randomly put the field below or above the cutoff */
+        nf_set_powers_cutoff(nf2, len - 1 + n_randint(state, 3));
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+        nf_elem_init(c, nf);
+        nf_elem_init(c2, nf2);
+
+        nf_elem_randtest(a, state, 100, nf);
+        nf_elem_randtest(b, state, 100, nf);
+
+        nf_elem_mul(c, a, b, nf);
+        nf_elem_mul(c2, a, b, nf2);
+
+        /* and change it again once the powers may be in use */
+        nf_set_powers_cutoff(nf2, n_randint(state, 2*len));
+        nf_elem_mul(a, a, b, nf2);
+
+        result = (nf_elem_equal(c, c2, nf) && nf_elem_equal(a, c, nf));
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd, cutoff = %wd\n", len, nf2->powers_cutoff);
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("c = "); nf_elem_print_pretty(c, nf, "x"); printf("\n");
+           printf("c2 = "); nf_elem_print_pretty(c2, nf2, "x"); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+        nf_elem_clear(c, nf);
+        nf_elem_clear(c2, nf2);
+
+        nf_clear(nf);
+        nf_clear(nf2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("write_bin....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test reading back what was written, to a buffer and to a file */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        fmpq_poly_t pol1, pol2;
+        nf_bin_stream_t s;
+        unsigned char * buf;
+        slong size;
+        FILE * file;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        fmpq_poly_init(pol1);
+        fmpq_poly_init(pol2);
+
+        /* find the size without writing anything */
+        nf_bin_stream_init_buf(s, NULL, 0);
+        result = nf_write_bin(s, nf);
+        size = s->pos;
+
+        buf = (unsigned char *) flint_malloc(size);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = result && nf_write_bin(s, nf) && s->pos == size;
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = result && nf_read_bin(pol1, s) && s->pos == size;
+
+        file = tmpfile();
+
+        nf_bin_stream_init_file(s, file);
+        result = result && nf_write_bin(s, nf);
+
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        result = result && nf_read_bin(pol2, s);
+
+        fclose(file);
+
+        result = result && fmpq_poly_equal(pol1, nf->pol)
+                        && fmpq_poly_equal(pol2, nf->pol);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           printf("pol1 = "); fmpq_poly_print_pretty(pol1, "x"); printf("\n");
+           printf("pol2 = "); fmpq_poly_print_pretty(pol2, "x"); printf("\n");
+           abort();
+        }
+
+        flint_free(buf);
+        fmpq_poly_clear(pol1);
+        fmpq_poly_clear(pol2);
+
+        nf_clear(nf);
+    }
+
+    /* test truncated and corrupted data is rejected */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        fmpq_poly_t pol;
+        nf_bin_stream_t s;
+        unsigned char * buf;
+        slong size, j;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        fmpq_poly_init(pol);
+
+        nf_bin_stream_init_buf(s, NULL, 0);
+        nf_write_bin(s, nf);
+        size = s->pos;
+
+        buf = (unsigned char *) flint_malloc(size);
+
+        /* a buffer which is too small is detected, but still counted */
+        j = n_randint(state, size);
+        nf_bin_stream_init_buf(s, buf, j);
+        result = !nf_write_bin(s, nf) && s->pos == size;
+
+        nf_bin_stream_init_buf(s, buf, size);
+        nf_write_bin(s, nf);
+
+        nf_bin_stream_init_buf(s, buf, j);
+        result = result && !nf_read_bin(pol, s);
+
+        /* change a byte after the tag and version */
+        j = 16 + n_randint(state, size - 16);
+        buf[j] ^= 1 + n_randint(state, 255);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = result && !nf_read_bin(pol, s);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           flint_printf("size = %wd, j = %wd\n", size, j);
+           abort();
+        }
+
+        flint_free(buf);
+        fmpq_poly_clear(pol);
+
+        nf_clear(nf);
+    }
+
+    /* test non-canonical data and lengths beyond the end of a file */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        fmpq_poly_t pol;
+        nf_bin_stream_t s;
+        fmpz_t c, x;
+        fmpz * num;
+        slong len, j;
+        FILE * file;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        fmpq_poly_init(pol);
+        fmpz_init(x);
+        fmpz_init(c);
+
+        len = nf->pol->length;
+
+        /* scale the numerator and denominator by a common factor */
+        fmpz_set_ui(c, 2 + n_randint(state, 100));
+
+        num = _fmpz_vec_init(len);
+        _fmpz_vec_scalar_mul_fmpz(num, fmpq_poly_numref(nf->pol), len, c);
+        fmpz_mul(x, fmpq_poly_denref(nf->pol), c);
+
+        file = tmpfile();
+
+        nf_bin_stream_init_file(s, file);
+        _nf_bin_write(s, (const unsigned char *) NF_BIN_MAGIC_NF, 8);
+        _nf_bin_write_ui(s, NF_BIN_VERSION);
+        _nf_bin_write_ui(s, _nf_hash(num, x, len));
+        _nf_bin_write_ui(s, len);
+        _nf_bin_write_fmpz(s, x);
+
+        for (j = 0; j < len; j++)
+           _nf_bin_write_fmpz(s, num + j);
+
+        /* an integer claiming far more limbs than follow */
+        _nf_bin_write_ui(s, 2*(WORD_MAX/32));
+        _nf_bin_write_ui(s, 1);
+
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        result = !nf_read_bin(pol, s) && fmpq_poly_is_zero(pol);
+
+        nf_bin_stream_init_file(s, file);
+        result = result && !_nf_bin_read_fmpz(x, s);
+
+        /* a number field claiming far more coefficients than follow */
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        _nf_bin_write(s, (const unsigned char *) NF_BIN_MAGIC_NF, 8);
+        _nf_bin_write_ui(s, NF_BIN_VERSION);
+        _nf_bin_write_ui(s, nf_hash(nf));
+        _nf_bin_write_ui(s, WORD_MAX/16);
+
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        result = result && !nf_read_bin(pol, s) && fmpq_poly_is_zero(pol);
+
+        fclose(file);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           printf("c = "); fmpz_print(c); printf("\n");
+           abort();
+        }
+
+        _fmpz_vec_clear(num, len);
+        fmpz_clear(c);
+        fmpz_clear(x);
+        fmpq_poly_clear(pol);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
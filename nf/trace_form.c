@@ -0,0 +1,71 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpq.h"
+#include "nf.h"
+
+/*
+   Compute Tr(theta^k) for k < 2d - 1 and set res to the matrix
+   Tr(theta^(i + j)). The traces for k >= d follow from those for k < d by
+   the recurrence sum_{j = 0}^d f_j S_{k - d + j} = 0.
+*/
+void _nf_trace_form(fmpq_mat_t res, const nf_t nf)
+{
+   const slong d = fmpq_poly_degree(nf->pol);
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   fmpq_poly_t T;
+   const fmpq_poly_struct * traces = nf->traces;
+   fmpq * S;
+   fmpq_t t;
+   slong i, j, k;
+
+   if (!(nf->precomp & NF_PRECOMP_TRACES))
+   {
+      fmpq_poly_init2(T, d);
+      _nf_traces(fmpq_poly_numref(T), fmpq_poly_denref(T), nf);
+      traces = T;
+   }
+
+   S = flint_malloc((2*d - 1)*sizeof(fmpq));
+   for (k = 0; k < 2*d - 1; k++)
+      fmpq_init(S + k);
+   fmpq_init(t);
+
+   for (k = 0; k < d; k++)
+   {
+      fmpz_set(fmpq_numref(S + k), fmpq_poly_numref(traces) + k);
+      fmpz_set(fmpq_denref(S + k), fmpq_poly_denref(traces));
+      fmpq_canonicalise(S + k);
+   }
+
+   for (k = d; k < 2*d - 1; k++)
+   {
+      for (j = 1; j <= d; j++)
+      {
+         fmpq_mul_fmpz(t, S + k - j, fnum + d - j);
+         fmpq_sub(S + k, S + k, t);
+      }
+
+      fmpq_div_fmpz(S + k, S + k, fnum + d);
+   }
+
+   for (i = 0; i < d; i++)
+      for (j = 0; j < d; j++)
+         fmpq_set(fmpq_mat_entry(res, i, j), S + i + j);
+
+   for (k = 0; k < 2*d - 1; k++)
+      fmpq_clear(S + k);
+   flint_free(S);
+   fmpq_clear(t);
+
+   if (traces == T)
+      fmpq_poly_clear(T);
+}
@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+/* 
+   Uses the recursive formula from pp. 163 of "A Course in Computational Algebraic 
+   Number Theory" by Henri Cohen
+*/
+void _nf_traces(fmpz * num, fmpz_t den, const nf_t nf)
+{
+   const fmpq_poly_struct * pol = nf->pol;
+   slong i, j;
+   slong len = pol->length, deg = len - 1;
+
+   fmpz * lead = fmpq_poly_numref(pol) + len - 1;
+
+   fmpz_one(den);
+
+   for (i = 1; i < deg; i++)
+   {
+      fmpz_mul_si(num + i, fmpq_poly_numref(pol) + deg - i, i); 
+      
+      for (j = i - 1; j >= 1; j--)
+      {
+         fmpz_mul(num + i, num + i, lead);
+         fmpz_addmul(num + i, fmpq_poly_numref(pol) + deg - j, num + i - j);
+      }
+      
+      fmpz_neg(num + i, num + i);
+   }
+
+   for (i = 1; i < deg; i++)
+   {
+      fmpz_mul(num + deg - i, num + deg - i, den);
+      fmpz_mul(den, den, lead);
+   }
+
+   fmpz_mul_si(num, den, deg);
+}
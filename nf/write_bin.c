@@ -0,0 +1,30 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf.h"
+
+int nf_write_bin(nf_bin_stream_t s, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   slong i;
+
+   _nf_bin_write(s, (const unsigned char *) NF_BIN_MAGIC_NF, 8);
+   _nf_bin_write_ui(s, NF_BIN_VERSION);
+   _nf_bin_write_ui(s, nf_hash(nf));
+
+   _nf_bin_write_ui(s, len);
+   _nf_bin_write_fmpz(s, fmpq_poly_denref(nf->pol));
+
+   for (i = 0; i < len; i++)
+      _nf_bin_write_fmpz(s, fmpq_poly_numref(nf->pol) + i);
+
+   return !s->error;
+}
@@ -29,6 +29,7 @@
 #include "flint/fmpq_mat.h"
 #include "flint/fmpz_mat.h"
 #include "flint/fmpz_mod_poly.h"
+#include "flint/fmpz_factor.h"
 #include "nf.h"
 
 #ifdef __cplusplus
@@ -70,6 +71,22 @@ typedef nf_elem_struct nf_elem_t[1];
 #define LNF_ELEM(xxx) (xxx)->lelem
 #define QNF_ELEM(xxx) (xxx)->qelem
 
+/* fixed prime and evaluation point for fingerprints of elements */
+#define NF_ELEM_HASH_PRIME NF_HASH_PRIME
+#define NF_ELEM_HASH_POINT NF_HASH_POINT
+
+/*
+   minimum number of bits of a denominator for which _nf_elem_equal compares
+   fingerprints before cross multiplying
+*/
+#define NF_ELEM_EQUAL_HASH_CUTOFF (4*FLINT_BITS)
+
+/*
+   minimum length of both factors for which nf_elem_mul_vec multiplies by
+   Kronecker substitution into scratch space shared by the batch
+*/
+#define NF_ELEM_MUL_VEC_KS_CUTOFF 7
+
 /******************************************************************************
 
     Initialisation
@@ -113,6 +130,10 @@ ANTIC_DLL int _nf_elem_equal(const nf_elem_t a, const nf_elem_t b, const nf_t nf
 
 ANTIC_DLL int nf_elem_equal(const nf_elem_t a, const nf_elem_t b, const nf_t nf);
 
+ANTIC_DLL int _nf_elem_hash(ulong * h, const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL ulong nf_elem_hash(const nf_elem_t a, const nf_t nf);
+
 NF_ELEM_INLINE
 int nf_elem_is_zero(const nf_elem_t a, const nf_t nf)
 {
@@ -698,10 +719,16 @@ ANTIC_DLL void _nf_elem_mul_red(nf_elem_t a, const nf_elem_t b,
 ANTIC_DLL void nf_elem_mul_red(nf_elem_t a, const nf_elem_t b,
                                     const nf_elem_t c, const nf_t nf, int red);
 
+ANTIC_DLL void nf_elem_mul_vec(nf_elem_struct * a, const nf_elem_struct * b,
+                         const nf_elem_struct * c, slong n, const nf_t nf);
+
 ANTIC_DLL void _nf_elem_inv(nf_elem_t a, const nf_elem_t b, const nf_t nf);
 
 ANTIC_DLL void nf_elem_inv(nf_elem_t a, const nf_elem_t b, const nf_t nf);
 
+ANTIC_DLL int _nf_elem_inv_modular(nf_elem_t a,
+                                          const nf_elem_t b, const nf_t nf);
+
 ANTIC_DLL void _nf_elem_div(nf_elem_t a, const nf_elem_t b, const nf_elem_t c, const nf_t nf);
 
 ANTIC_DLL void nf_elem_div(nf_elem_t a, const nf_elem_t b, const nf_elem_t c, const nf_t nf);
@@ -710,25 +737,98 @@ ANTIC_DLL void _nf_elem_pow(nf_elem_t res, const nf_elem_t b, ulong e, const nf_
 
 ANTIC_DLL void nf_elem_pow(nf_elem_t res, const nf_elem_t a, ulong e, const nf_t nf);
 
+ANTIC_DLL void _nf_elem_pow_fmpz(nf_elem_t res, const nf_elem_t a,
+                                            const fmpz_t e, const nf_t nf);
+
+ANTIC_DLL void nf_elem_pow_fmpz(nf_elem_t res, const nf_elem_t a,
+                                            const fmpz_t e, const nf_t nf);
+
+ANTIC_DLL void nf_elem_powmod_fmpz(nf_elem_t res, const nf_elem_t a,
+                           const fmpz_t e, const fmpz_t m, const nf_t nf);
+
 ANTIC_DLL void _nf_elem_norm(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf);
 
 ANTIC_DLL void nf_elem_norm(fmpq_t res, const nf_elem_t a, const nf_t nf);
 
+ANTIC_DLL void _nf_elem_norm_modular(fmpz_t rnum, fmpz_t rden,
+                                      const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL void nf_elem_norm_vec(fmpq * res, const nf_elem_struct * a,
+                                                  slong len, const nf_t nf);
+
+ANTIC_DLL void nf_elem_norm_vec_mod(fmpz * res, const nf_elem_struct * a,
+       slong len, const mp_limb_t * primes, slong num_primes, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_norm_ab(fmpz * res, slong a0, slong alen,
+                                     slong b0, slong blen, const nf_t nf);
+
+ANTIC_DLL void nf_elem_norm_ab(fmpq * res, slong a0, slong alen,
+                                     slong b0, slong blen, const nf_t nf);
+
+ANTIC_DLL void nf_elem_norm_ab_log(unsigned char * res, slong a0, slong alen,
+                                     slong b0, slong blen, const nf_t nf);
+
 ANTIC_DLL void _nf_elem_norm_div(fmpz_t rnum, fmpz_t rden, const nf_elem_t a,
                              const nf_t nf, const fmpz_t divisor, slong nbits);
 
 ANTIC_DLL void nf_elem_norm_div(fmpq_t res, const nf_elem_t a, const nf_t nf,
                                             const fmpz_t divisor, slong nbits);
 
+ANTIC_DLL int nf_elem_norm_is_smooth(fmpz_factor_t fac, const nf_elem_t a,
+          const nf_t nf, const mp_limb_t * primes, slong num_primes,
+                                       const fmpz_t divisor, slong nbits);
+
 ANTIC_DLL void _nf_elem_trace(fmpz_t rnum, fmpz_t rden, const nf_elem_t a,
                                                                 const nf_t nf);
 
 ANTIC_DLL void nf_elem_trace(fmpq_t res, const nf_elem_t a, const nf_t nf);
 
+ANTIC_DLL void _nf_elem_trace_vec(fmpz * rnum, fmpz_t rden,
+                      const nf_elem_struct * a, slong len, const nf_t nf);
+
+ANTIC_DLL void nf_elem_trace_vec(fmpq * res, const nf_elem_struct * a,
+                                                   slong len, const nf_t nf);
+
+ANTIC_DLL void nf_elem_trace_powers(fmpq * res, const nf_elem_t a,
+                                                   slong n, const nf_t nf);
+
+ANTIC_DLL void nf_elem_trace_form_mat(fmpq_mat_t res, const nf_t nf);
+
 ANTIC_DLL void nf_elem_rep_mat(fmpq_mat_t res, const nf_elem_t a, const nf_t nf);
 
 ANTIC_DLL void nf_elem_rep_mat_fmpz_mat_den(fmpz_mat_t res, fmpz_t den, const nf_elem_t a, const nf_t nf);
 
+ANTIC_DLL void _nf_elem_rep_mat_fmpz_mat_den(fmpz_mat_t res, fmpz_t den,
+                        const nf_elem_t a, const nf_t nf, int canonicalise);
+
+ANTIC_DLL void _nf_elem_charpoly_modular(fmpq_poly_t res,
+                                        const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_charpoly_rep_mat(fmpq_poly_t res,
+                                        const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL void nf_elem_charpoly(fmpq_poly_t res, const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL void nf_elem_minpoly(fmpq_poly_t res, const nf_elem_t a, const nf_t nf);
+
+/******************************************************************************
+
+    Binary serialisation
+
+******************************************************************************/
+
+ANTIC_DLL int _nf_elem_write_bin(nf_bin_stream_t s, const nf_elem_t a,
+                                          const fmpz_t den, const nf_t nf);
+
+ANTIC_DLL int nf_elem_write_bin(nf_bin_stream_t s,
+                                           const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL int _nf_elem_read_bin(nf_elem_t a, nf_bin_stream_t s,
+                                          const fmpz_t den, const nf_t nf);
+
+ANTIC_DLL int nf_elem_read_bin(nf_elem_t a, nf_bin_stream_t s,
+                                                             const nf_t nf);
+
 /******************************************************************************
 
     Modular reduction
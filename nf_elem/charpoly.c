@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpq.h"
+#include "nf_elem.h"
+
+static int _nf_elem_charpoly_use_modular(const nf_t nf)
+{
+   return fmpq_poly_degree(nf->pol) >= 8;
+}
+
+void nf_elem_charpoly(fmpq_poly_t res, const nf_elem_t a, const nf_t nf)
+{
+   const slong d = fmpq_poly_degree(nf->pol);
+
+   if (nf_elem_is_rational(a, nf))
+   {
+      /* (x - a)^d */
+      nf_elem_get_fmpq_poly(res, a, nf);
+      fmpq_poly_neg(res, res);
+      fmpq_poly_set_coeff_ui(res, 1, 1);
+
+      if (d > 1)
+         fmpq_poly_pow(res, res, d);
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      /* x^2 - T(a) x + N(a) */
+      fmpq_t t;
+
+      fmpq_init(t);
+
+      fmpq_poly_zero(res);
+      fmpq_poly_set_coeff_ui(res, 2, 1);
+
+      nf_elem_trace(t, a, nf);
+      fmpq_neg(t, t);
+      fmpq_poly_set_coeff_fmpq(res, 1, t);
+
+      nf_elem_norm(t, a, nf);
+      fmpq_poly_set_coeff_fmpq(res, 0, t);
+
+      fmpq_clear(t);
+   } else if (_nf_elem_charpoly_use_modular(nf))
+      _nf_elem_charpoly_modular(res, a, nf);
+   else
+      _nf_elem_charpoly_rep_mat(res, a, nf);
+}
@@ -0,0 +1,224 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "flint/fmpq.h"
+#include "flint/nmod_vec.h"
+#include "flint/nmod_poly.h"
+#include "flint/thread_support.h"
+#include "nf_elem.h"
+
+/* minimum number of primes handled by each thread */
+#define NF_ELEM_CHARPOLY_MODULAR_THREAD_CUTOFF 2
+
+typedef struct
+{
+   mp_limb_t * res;
+   slong stride;
+   const nf_nmod_struct * mods;
+   slong num;
+   slong len;
+   const fmpz * anum;
+   slong alen;
+} _charpoly_worker_arg_struct;
+
+/*
+   Compute R(x) = Res_y(f(y), x - a(y)) modulo each of a block of primes,
+   by evaluation at x = 0, 1, ..., deg(f) and interpolation. Coefficient k
+   of the image modulo the i-th prime is written to res[k*stride + i].
+*/
+static void
+_nf_elem_charpoly_modular_worker(void * varg)
+{
+   _charpoly_worker_arg_struct * arg = (_charpoly_worker_arg_struct *) varg;
+   const slong len = arg->len, alen = arg->alen;
+   nmod_poly_t gp, rp;
+   mp_ptr xs, ys;
+   slong i, j;
+
+   xs = _nmod_vec_init(len);
+   ys = _nmod_vec_init(len);
+
+   for (j = 0; j < len; j++)
+      xs[j] = j;
+
+   for (i = 0; i < arg->num; i++)
+   {
+      const nf_nmod_struct * mod = arg->mods + i;
+      const nmod_poly_struct * fp = mod->pol;
+
+      nmod_poly_init2(gp, mod->n, alen);
+      nmod_poly_init2(rp, mod->n, len);
+
+      for (j = 0; j < alen; j++)
+         gp->coeffs[j] = nmod_neg(fmpz_fdiv_ui(arg->anum + j, mod->n), fp->mod);
+      _nmod_poly_set_length(gp, alen);
+
+      /* only the constant coefficient of x - a(y) depends on x */
+      for (j = 0; j < len; j++)
+      {
+         if (j != 0)
+            gp->coeffs[0] = nmod_add(gp->coeffs[0], 1, fp->mod);
+
+         ys[j] = nmod_poly_resultant(fp, gp);
+      }
+
+      nmod_poly_interpolate_nmod_vec_fast(rp, xs, ys, len);
+
+      for (j = 0; j < len; j++)
+         arg->res[j*arg->stride + i] = nmod_poly_get_coeff_ui(rp, j);
+
+      nmod_poly_clear(gp);
+      nmod_poly_clear(rp);
+   }
+
+   _nmod_vec_clear(xs);
+   _nmod_vec_clear(ys);
+}
+
+void _nf_elem_charpoly_modular(fmpq_poly_t res,
+                                        const nf_elem_t a, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   const slong alen = NF_ELEM(a)->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   const fmpz * const anum = NF_ELEM_NUMREF(a);
+   thread_pool_handle * threads;
+   _charpoly_worker_arg_struct * args;
+   nf_nmod_struct * mods;
+   mp_limb_t * primes, * residues, p;
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   fmpq_t s;
+   slong fbits, abits, bound, num_primes, num_threads, num_workers, i, start;
+
+   if (alen < 2)
+   {
+      flint_printf("Exception (_nf_elem_charpoly_modular). "
+                   "Element is rational.\n");
+      abort();
+   }
+
+   /*
+      Hadamard bound for the Sylvester matrix of f(y) and x - a(y) on the
+      unit circle, |R(x)| <= |f|^deg(a) (|a| + 1)^deg(f), which bounds the
+      coefficients of R. One bit is added for the sign.
+   */
+   fbits = FLINT_ABS(_fmpz_vec_max_bits(fnum, len)) + FLINT_BIT_COUNT(len);
+   abits = FLINT_ABS(_fmpz_vec_max_bits(anum, alen)) + FLINT_BIT_COUNT(alen) + 1;
+   bound = (alen - 1)*fbits + (len - 1)*abits + 2;
+
+   /*
+      Primes dividing a leading coefficient are skipped so that the
+      resultants modulo p are images of the resultants over Z. The
+      interpolation points 0, ..., deg(f) are distinct modulo word primes.
+   */
+   num_primes = (bound + FLINT_BITS - 2)/(FLINT_BITS - 1);
+
+   primes = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+   residues = (mp_limb_t *) flint_malloc(len*num_primes*sizeof(mp_limb_t));
+   mods = (nf_nmod_struct *) flint_malloc(num_primes*sizeof(nf_nmod_struct));
+
+   /* images of f, computed before any threads start */
+   p = UWORD(1) << (FLINT_BITS - 1);
+
+   for (i = 0; i < num_primes; )
+   {
+      p = n_nextprime(p, 0);
+      _nf_nmod_init(mods + i, nf, p);
+
+      if (mods[i].pol->length == len && fmpz_fdiv_ui(anum + alen - 1, p) != 0)
+         primes[i++] = p;
+      else
+         _nf_nmod_clear(mods + i);
+   }
+
+   /* compute the images, in parallel if there are enough primes */
+   num_threads = FLINT_MIN(flint_get_num_threads(),
+                          num_primes/NF_ELEM_CHARPOLY_MODULAR_THREAD_CUTOFF);
+
+   num_workers = flint_request_threads(&threads, FLINT_MAX(num_threads, 1));
+
+   args = (_charpoly_worker_arg_struct *)
+            flint_malloc((num_workers + 1)*sizeof(_charpoly_worker_arg_struct));
+
+   start = 0;
+   for (i = 0; i <= num_workers; i++)
+   {
+      slong end = ((i + 1)*num_primes)/(num_workers + 1);
+
+      args[i].res = residues + start;
+      args[i].stride = num_primes;
+      args[i].mods = mods + start;
+      args[i].num = end - start;
+      args[i].len = len;
+      args[i].anum = anum;
+      args[i].alen = alen;
+
+      start = end;
+   }
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wake(global_thread_pool, threads[i], 0,
+                                 _nf_elem_charpoly_modular_worker, &args[i]);
+
+   _nf_elem_charpoly_modular_worker(&args[num_workers]);
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wait(global_thread_pool, threads[i]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   /* R by Chinese remaindering of each coefficient, symmetric remainder */
+   fmpq_poly_fit_length(res, len);
+
+   fmpz_comb_init(comb, primes, num_primes);
+   fmpz_comb_temp_init(comb_temp, comb);
+
+   for (i = 0; i < len; i++)
+      fmpz_multi_CRT_ui(fmpq_poly_numref(res) + i, residues + i*num_primes,
+                                                      comb, comb_temp, 1);
+
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   /*
+      R(x) = lead(f)^deg(a) charpoly(num(a)), and the characteristic
+      polynomial of a is charpoly(num(a))(den(a) x)/den(a)^deg(f).
+   */
+   fmpz_pow_ui(fmpq_poly_denref(res), fnum + len - 1, alen - 1);
+
+   if (fmpz_sgn(fmpq_poly_denref(res)) < 0)
+   {
+      fmpz_neg(fmpq_poly_denref(res), fmpq_poly_denref(res));
+      _fmpz_vec_neg(fmpq_poly_numref(res), fmpq_poly_numref(res), len);
+   }
+
+   _fmpq_poly_set_length(res, len);
+   fmpq_poly_canonicalise(res);
+
+   if (!fmpz_is_one(NF_ELEM_DENREF(a)))
+   {
+      fmpq_init(s);
+      fmpz_set(fmpq_numref(s), NF_ELEM_DENREF(a));
+      fmpq_poly_rescale(res, res, s);
+      fmpq_poly_make_monic(res, res);
+      fmpq_clear(s);
+   }
+
+   for (i = 0; i < num_primes; i++)
+      _nf_nmod_clear(mods + i);
+
+   flint_free(primes);
+   flint_free(residues);
+   flint_free(mods);
+   flint_free(args);
+}
@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_mat.h"
+#include "nf_elem.h"
+
+void _nf_elem_charpoly_rep_mat(fmpq_poly_t res,
+                                        const nf_elem_t a, const nf_t nf)
+{
+    const slong d = fmpq_poly_degree(nf->pol);
+    fmpz_mat_t M;
+    fmpz_poly_t P;
+    fmpq_t s;
+
+    fmpz_mat_init(M, d, d);
+    fmpz_poly_init(P);
+    fmpq_init(s);
+
+    /* charpoly(M/s)(x) = charpoly(M)(s x)/s^d */
+    _nf_elem_rep_mat_fmpz_mat_den(M, fmpq_numref(s), a, nf, 1);
+
+    fmpz_mat_charpoly(P, M);
+    fmpq_poly_set_fmpz_poly(res, P);
+
+    if (!fmpz_is_one(fmpq_numref(s)))
+    {
+        fmpq_poly_rescale(res, res, s);
+        fmpq_poly_make_monic(res, res);
+    }
+
+    fmpz_mat_clear(M);
+    fmpz_poly_clear(P);
+    fmpq_clear(s);
+}
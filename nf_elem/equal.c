@@ -56,6 +56,7 @@ int _nf_elem_equal(const nf_elem_t a, const nf_elem_t b, const nf_t nf)
    } else if (nf->flag & NF_QUADRATIC)
    {
       slong d, bits1, bits2;
+      ulong h1, h2;
       int res = 1;
 
       const fmpz * const anum = QNF_ELEM_NUMREF(a);
@@ -80,6 +81,14 @@ int _nf_elem_equal(const nf_elem_t a, const nf_elem_t b, const nf_t nf)
       if (!(bits1 == 0 && bits2 == 0) && (ulong) (bits1 - bits2 + d) > 2)
          return 0;
 
+      /*
+         distinct fingerprints prove the elements differ, but they only pay
+         off if the cross multiplication below is by a large denominator
+      */
+      if (FLINT_MAX(fmpz_bits(aden), fmpz_bits(bden)) > NF_ELEM_EQUAL_HASH_CUTOFF
+       && _nf_elem_hash(&h1, a, nf) && _nf_elem_hash(&h2, b, nf) && h1 != h2)
+         return 0;
+
       fmpz_init(t1);
       fmpz_init(t2);
 
@@ -126,6 +135,7 @@ cleanup:
           fmpz * p2 = NF_ELEM_NUMREF(b);
           fmpz_t gcd, den1, den2;
           fmpz * t1, * t2;
+          ulong h1, h2;
           int equal;
   
           for (i = 0; i < len1; i++)
@@ -135,6 +145,14 @@ cleanup:
              if (!(b1 == 0 && b2 == 0) && (ulong) (b1 - b2 + d) > 2)
                 return 0;
           }
+
+          /* as above, only worth it for large denominators */
+          if (FLINT_MAX(fmpz_bits(fmpq_poly_denref(NF_ELEM(a))),
+                        fmpz_bits(fmpq_poly_denref(NF_ELEM(b))))
+                                                > NF_ELEM_EQUAL_HASH_CUTOFF
+           && _nf_elem_hash(&h1, a, nf) && _nf_elem_hash(&h2, b, nf)
+                                                                && h1 != h2)
+             return 0;
  
           fmpz_init(gcd);
           fmpz_init(den1);
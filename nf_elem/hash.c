@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem.h"
+
+/*
+   Set h to the image of num(a) under reduction modulo p and evaluation at
+   a fixed point, times the inverse of den(a) modulo p. Returns 0 if den(a)
+   is not invertible modulo p, in which case h is the image of num(a).
+*/
+int _nf_elem_hash(ulong * h, const nf_elem_t a, const nf_t nf)
+{
+   const mp_limb_t p = NF_ELEM_HASH_PRIME;
+   const fmpz * anum, * aden;
+   mp_limb_t pinv, r, d;
+   slong i, alen;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      anum = LNF_ELEM_NUMREF(a);
+      aden = LNF_ELEM_DENREF(a);
+      alen = 1;
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      anum = QNF_ELEM_NUMREF(a);
+      aden = QNF_ELEM_DENREF(a);
+      alen = 2;
+   } else
+   {
+      anum = NF_ELEM_NUMREF(a);
+      aden = NF_ELEM_DENREF(a);
+      alen = NF_ELEM(a)->length;
+   }
+
+   pinv = n_preinvert_limb(p);
+
+   /* Horner evaluation of num(a) modulo p */
+   r = 0;
+   for (i = alen - 1; i >= 0; i--)
+   {
+      r = n_mulmod2_preinv(r, NF_ELEM_HASH_POINT, p, pinv);
+      r = n_addmod(r, fmpz_fdiv_ui(anum + i, p), p);
+   }
+
+   d = fmpz_fdiv_ui(aden, p);
+
+   if (d == 0)
+   {
+      *h = r;
+      return 0;
+   }
+
+   if (d != 1)
+      r = n_mulmod2_preinv(r, n_invmod(d, p), p, pinv);
+
+   *h = r;
+   return 1;
+}
+
+ulong nf_elem_hash(const nf_elem_t a, const nf_t nf)
+{
+   ulong h;
+
+   _nf_elem_hash(&h, a, nf);
+
+   return h;
+}
@@ -16,6 +16,32 @@
 
 #include "nf_elem.h"
 
+/*
+   The xgcd over Q suffers from coefficient swell once the degree or the
+   size of the coefficients is moderately large, at which point the
+   multimodular algorithm wins.
+*/
+static int _nf_elem_inv_use_modular(const nf_elem_t b, const nf_t nf)
+{
+   const slong deg = fmpq_poly_degree(nf->pol);
+   slong bits;
+
+   if (NF_ELEM(b)->length == 0)
+      return 0;
+
+   if (deg >= 8)
+      return 1;
+
+   if (deg < 4)
+      return 0;
+
+   bits = FLINT_MAX(
+          FLINT_ABS(_fmpz_vec_max_bits(NF_ELEM_NUMREF(b), NF_ELEM(b)->length)),
+          FLINT_ABS(_fmpz_vec_max_bits(fmpq_poly_numref(nf->pol), deg + 1)));
+
+   return bits >= 64;
+}
+
 void _nf_elem_inv(nf_elem_t a, const nf_elem_t b, const nf_t nf)
 {
    if (nf->flag & NF_LINEAR)
@@ -48,6 +74,9 @@ void _nf_elem_inv(nf_elem_t a, const nf_elem_t b, const nf_t nf)
    {
       fmpq_poly_t g, t;
 
+      if (_nf_elem_inv_use_modular(b, nf) && _nf_elem_inv_modular(a, b, nf))
+         return;
+
       fmpq_poly_init(g);
       fmpq_poly_init(t);
 
@@ -0,0 +1,236 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpq.h"
+#include "flint/nmod_poly.h"
+#include "nf_elem.h"
+
+/*
+   Given residues res modulo M, attempt to reconstruct rationals with a
+   common denominator, i.e. find {num, den} with num[i]/den = res[i] mod M.
+   Each coefficient is first multiplied by the denominator found so far, so
+   that in the common case only the first reconstruction is nontrivial.
+*/
+static int
+_nf_elem_inv_modular_reconstruct(fmpz * num, fmpz_t den,
+                                 const fmpz * res, slong len, const fmpz_t M)
+{
+   fmpz_t t;
+   fmpq_t q;
+   slong i;
+   int ok = 1;
+
+   fmpz_init(t);
+   fmpq_init(q);
+
+   fmpz_one(den);
+
+   for (i = 0; i < len && ok; i++)
+   {
+      fmpz_mul(t, res + i, den);
+      fmpz_mod(t, t, M);
+
+      ok = fmpq_reconstruct_fmpz(q, t, M);
+
+      if (ok)
+      {
+         fmpz_swap(num + i, fmpq_numref(q));
+
+         if (!fmpz_is_one(fmpq_denref(q)))
+         {
+            _fmpz_vec_scalar_mul_fmpz(num, num, i, fmpq_denref(q));
+            fmpz_mul(den, den, fmpq_denref(q));
+         }
+      }
+   }
+
+   fmpz_clear(t);
+   fmpq_clear(q);
+
+   return ok;
+}
+
+/*
+   Check whether the candidate {num, den, len} reduces to g modulo the
+   modulus of g. Returns -1 if the check cannot be made as the denominator
+   vanishes modulo p.
+*/
+static int
+_nf_elem_inv_modular_check(const fmpz * num, const fmpz_t den, slong len,
+                                                        const nmod_poly_t g)
+{
+   const nmod_t mod = g->mod;
+   mp_limb_t dinv, c;
+   slong i;
+
+   dinv = fmpz_fdiv_ui(den, mod.n);
+   if (dinv == 0)
+      return -1;
+   dinv = n_invmod(dinv, mod.n);
+
+   while (len > 0 && fmpz_fdiv_ui(num + len - 1, mod.n) == 0)
+      len--;
+
+   if (len != g->length)
+      return 0;
+
+   for (i = 0; i < len; i++)
+   {
+      c = n_mulmod2_preinv(fmpz_fdiv_ui(num + i, mod.n), dinv,
+                                                        mod.n, mod.ninv);
+      if (c != g->coeffs[i])
+         return 0;
+   }
+
+   return 1;
+}
+
+/*
+   Set a to den(b)*{num, den, len}, i.e. the candidate for the inverse of b,
+   and verify that a*b = 1.
+*/
+static int
+_nf_elem_inv_modular_verify(nf_elem_t a, const fmpz * num, const fmpz_t den,
+                              slong len, const nf_elem_t b, const nf_t nf)
+{
+   nf_elem_t t;
+   int res;
+
+   fmpq_poly_fit_length(NF_ELEM(a), len);
+   _fmpz_vec_scalar_mul_fmpz(NF_ELEM_NUMREF(a), num, len, NF_ELEM_DENREF(b));
+   fmpz_set(NF_ELEM_DENREF(a), den);
+   _fmpq_poly_set_length(NF_ELEM(a), len);
+   _fmpq_poly_normalise(NF_ELEM(a));
+   fmpq_poly_canonicalise(NF_ELEM(a));
+
+   nf_elem_init(t, nf);
+   nf_elem_mul(t, a, b, nf);
+   res = nf_elem_is_one(t, nf);
+   nf_elem_clear(t, nf);
+
+   return res;
+}
+
+int _nf_elem_inv_modular(nf_elem_t a, const nf_elem_t b, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   const slong blen = NF_ELEM(b)->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   const fmpz * const bnum = NF_ELEM_NUMREF(b);
+   slong fbits, bbits, limit, bad, num_primes, glen, i;
+   fmpz_poly_t G;
+   fmpz * gnum;
+   fmpz_t M, gden;
+   nf_nmod_struct mod;
+   nmod_poly_t bp, gp;
+   mp_limb_t p;
+   int have_candidate = 0, success = 0;
+
+   if (blen == 0)
+   {
+      flint_printf("Exception (_nf_elem_inv_modular). Division by zero.\n");
+      abort();
+   }
+
+   /*
+      By Cramer's rule applied to the Sylvester matrix, the numerator and
+      denominator of b^{-1} mod f are bounded by the Hadamard bound of
+      Res(f, num(b)). Twice that many bits suffice for reconstruction.
+   */
+   fbits = FLINT_ABS(_fmpz_vec_max_bits(fnum, len)) + FLINT_BIT_COUNT(len);
+   bbits = FLINT_ABS(_fmpz_vec_max_bits(bnum, blen)) + FLINT_BIT_COUNT(blen);
+   limit = 2*((blen - 1)*fbits + (len - 1)*bbits) + 2;
+
+   fmpz_poly_init(G);
+   gnum = _fmpz_vec_init(len - 1);
+   fmpz_init(gden);
+   fmpz_init_set_ui(M, 1);
+
+   bad = 0;
+   num_primes = 0;
+   glen = 0;
+
+   p = UWORD(1) << (FLINT_BITS - 1);
+
+   for (i = 0; fmpz_bits(M) <= limit && bad <= limit/(FLINT_BITS - 1) + 1; i++)
+   {
+      p = n_nextprime(p, 0);
+      _nf_nmod_init(&mod, nf, p);
+
+      if (mod.pol->length < len)
+      {
+         _nf_nmod_clear(&mod);
+         bad++;
+         continue;
+      }
+
+      nmod_poly_init(bp, p);
+      nmod_poly_init(gp, p);
+
+      _nf_elem_get_nmod_poly(bp, b, nf);
+
+      if (bp->length == 0 || !nmod_poly_invmod(gp, bp, mod.pol))
+      {
+         bad++;
+      } else
+      {
+         /* test the last candidate with the new image before using it */
+         if (have_candidate)
+         {
+            int check = _nf_elem_inv_modular_check(gnum, gden, glen, gp);
+
+            if (check == 1)
+               success = _nf_elem_inv_modular_verify(a, gnum, gden,
+                                                             glen, b, nf);
+
+            if (check == 0 || (check == 1 && !success))
+               have_candidate = 0;
+         }
+
+         if (!success)
+         {
+            fmpz_poly_CRT_ui(G, G, M, gp, 0);
+            fmpz_mul_ui(M, M, p);
+            num_primes++;
+
+            /* attempt reconstruction each time the number of primes doubles */
+            if ((num_primes & (num_primes - 1)) == 0)
+            {
+               glen = G->length;
+               have_candidate = _nf_elem_inv_modular_reconstruct(gnum,
+                                                       gden, G->coeffs, glen, M);
+            }
+         }
+      }
+
+      nmod_poly_clear(bp);
+      nmod_poly_clear(gp);
+      _nf_nmod_clear(&mod);
+
+      if (success)
+         break;
+   }
+
+   /* final attempt using all the primes */
+   if (!success && num_primes > 0)
+   {
+      glen = G->length;
+      if (_nf_elem_inv_modular_reconstruct(gnum, gden, G->coeffs, glen, M))
+         success = _nf_elem_inv_modular_verify(a, gnum, gden, glen, b, nf);
+   }
+
+   fmpz_poly_clear(G);
+   _fmpz_vec_clear(gnum, len - 1);
+   fmpz_clear(gden);
+   fmpz_clear(M);
+
+   return success;
+}
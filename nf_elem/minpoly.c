@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem.h"
+
+void nf_elem_minpoly(fmpq_poly_t res, const nf_elem_t a, const nf_t nf)
+{
+   if (nf_elem_is_rational(a, nf))
+   {
+      nf_elem_get_fmpq_poly(res, a, nf);
+      fmpq_poly_neg(res, res);
+      fmpq_poly_set_coeff_ui(res, 1, 1);
+   } else
+   {
+      fmpq_poly_t g;
+
+      nf_elem_charpoly(res, a, nf);
+
+      /*
+         As the defining polynomial is irreducible the characteristic
+         polynomial is a power of the minimal polynomial, which is thus
+         its squarefree part.
+      */
+      fmpq_poly_init(g);
+
+      fmpq_poly_derivative(g, res);
+      fmpq_poly_gcd(g, res, g);
+
+      if (fmpq_poly_degree(g) > 0)
+         fmpq_poly_div(res, res, g);
+
+      fmpq_poly_clear(g);
+   }
+}
@@ -162,7 +162,7 @@ void _nf_elem_mul_red(nf_elem_t a, const nf_elem_t b,
       {
          if (nf->flag & NF_MONIC)
          {
-            if (len <= NF_POWERS_CUTOFF)
+            if (_nf_use_powers(nf))
             {
                _fmpz_poly_rem_powers_precomp(NF_ELEM_NUMREF(a), plen,
                   fmpq_poly_numref(nf->pol), len, nf->powers.zz->powers);
@@ -192,7 +192,7 @@ void _nf_elem_mul_red(nf_elem_t a, const nf_elem_t b,
          {
             fmpq_poly_t t;
         
-            if (len <= NF_POWERS_CUTOFF)
+            if (_nf_use_powers(nf))
             {
                _fmpq_poly_rem_powers_precomp(NF_ELEM_NUMREF(a), 
                   fmpq_poly_denref(NF_ELEM(a)), plen,
@@ -207,7 +207,7 @@ void _nf_elem_mul_red(nf_elem_t a, const nf_elem_t b,
         
                _fmpq_poly_rem(t->coeffs, t->den,
                   NF_ELEM(a)->coeffs, NF_ELEM(a)->den, plen, 
-                  nf->pol->coeffs, nf->pol->den, len, nf->pinv.qq); 
+                  nf->pol->coeffs, nf->pol->den, len, _nf_pinv(nf)); 
            
                _fmpq_poly_set_length(t, len - 1);
                _fmpq_poly_normalise(t);
@@ -0,0 +1,237 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "nf_elem.h"
+
+/*
+   Set {prod, len1 + len2 - 1} to the product of the normalised polynomials
+   {b, len1} and {c, len2}, where len1 >= len2, by packing both into
+   integers. The limbs {*arr, *alloc} are enlarged as required and reused
+   for the whole batch, so that no allocation is done per product.
+*/
+static void
+_nf_elem_mul_vec_KS(fmpz * prod, const fmpz * b, slong len1,
+            const fmpz * c, slong len2, mp_ptr * arr, slong * alloc)
+{
+   const int sqr = (b == c && len1 == len2);
+   int neg1, neg2, sign;
+   slong bits1, bits2, bits, limbs1, limbs2;
+   mp_ptr arr1, arr2, arr3;
+
+   neg1 = (fmpz_sgn(b + len1 - 1) > 0) ? 0 : -1;
+   neg2 = (fmpz_sgn(c + len2 - 1) > 0) ? 0 : -1;
+
+   /* negative if any coefficient is negative */
+   bits1 = _fmpz_vec_max_bits(b, len1);
+   bits2 = sqr ? bits1 : _fmpz_vec_max_bits(c, len2);
+   sign = (bits1 < 0 || bits2 < 0);
+
+   bits = FLINT_ABS(bits1) + FLINT_ABS(bits2) + FLINT_BIT_COUNT(len2) + sign;
+
+   limbs1 = (bits*len1 - 1)/FLINT_BITS + 1;
+   limbs2 = (bits*len2 - 1)/FLINT_BITS + 1;
+
+   if (2*(limbs1 + limbs2) > *alloc)
+   {
+      *alloc = FLINT_MAX(2*(limbs1 + limbs2), 2*(*alloc));
+      *arr = (mp_ptr) flint_realloc(*arr, (*alloc)*sizeof(mp_limb_t));
+   }
+
+   arr1 = *arr;
+   arr2 = arr1 + limbs1;
+   arr3 = arr2 + limbs2;
+
+   flint_mpn_zero(arr1, limbs1 + limbs2);
+
+   _fmpz_poly_bit_pack(arr1, b, len1, bits, neg1);
+
+   if (sqr)
+      mpn_sqr(arr3, arr1, limbs1);
+   else
+   {
+      _fmpz_poly_bit_pack(arr2, c, len2, bits, neg2);
+      mpn_mul(arr3, arr1, limbs1, arr2, limbs2);
+   }
+
+   if (sign)
+      _fmpz_poly_bit_unpack(prod, len1 + len2 - 1, arr3, bits, neg1 ^ neg2);
+   else
+      _fmpz_poly_bit_unpack_unsigned(prod, len1 + len2 - 1, arr3, bits);
+}
+
+/*
+   Multiply {b, len1} by {c, len2} into the scratch space {prod, den} and
+   reduce modulo the defining polynomial. Returns the length of the reduced
+   product. The scratch q, r is only used when no powers are precomputed,
+   and the limbs {*arr, *alloc} only for Kronecker substitution.
+*/
+static slong
+_nf_elem_mul_vec_generic(fmpz * prod, fmpz_t den, fmpz * q, fmpz * r,
+                    mp_ptr * arr, slong * alloc,
+                    const nf_elem_t b, const nf_elem_t c, const nf_t nf)
+{
+   const slong len1 = NF_ELEM(b)->length;
+   const slong len2 = NF_ELEM(c)->length;
+   const slong len = nf->pol->length;
+   const slong plen = len1 + len2 - 1;
+   slong i;
+
+   if (FLINT_MIN(len1, len2) >= NF_ELEM_MUL_VEC_KS_CUTOFF)
+   {
+      if (len1 >= len2)
+         _nf_elem_mul_vec_KS(prod, NF_ELEM_NUMREF(b), len1,
+                                  NF_ELEM_NUMREF(c), len2, arr, alloc);
+      else
+         _nf_elem_mul_vec_KS(prod, NF_ELEM_NUMREF(c), len2,
+                                  NF_ELEM_NUMREF(b), len1, arr, alloc);
+   } else if (len1 >= len2)
+      _fmpz_poly_mul(prod, NF_ELEM_NUMREF(b), len1, NF_ELEM_NUMREF(c), len2);
+   else
+      _fmpz_poly_mul(prod, NF_ELEM_NUMREF(c), len2, NF_ELEM_NUMREF(b), len1);
+
+   fmpz_mul(den, NF_ELEM_DENREF(b), NF_ELEM_DENREF(c));
+
+   if (plen < len)
+      return plen;
+
+   if (nf->flag & NF_MONIC)
+   {
+      if (_nf_use_powers(nf))
+      {
+         fmpz ** powers = nf->powers.zz->powers;
+
+         /* fused reduction using x^i mod f, from the top coefficient down */
+
+         for (i = plen - 1; i >= len - 1; i--)
+         {
+            if (!fmpz_is_zero(prod + i))
+               _fmpz_vec_scalar_addmul_fmpz(prod, powers[i], len - 1,
+                                                                  prod + i);
+         }
+      } else
+      {
+         _fmpz_vec_set(r, prod, plen);
+         _fmpz_poly_divrem(q, prod, r, plen, fmpq_poly_numref(nf->pol),
+                                                                    len, 0);
+      }
+   } else
+   {
+      if (_nf_use_powers(nf))
+      {
+         _fmpq_poly_rem_powers_precomp(prod, den, plen,
+            fmpq_poly_numref(nf->pol), fmpq_poly_denref(nf->pol),
+            len, nf->powers.qq->powers);
+      } else
+      {
+         fmpz_t rden;
+
+         fmpz_init(rden);
+
+         _fmpq_poly_rem(r, rden, prod, den, plen,
+            nf->pol->coeffs, nf->pol->den, len, _nf_pinv(nf));
+
+         _fmpz_vec_set(prod, r, len - 1);
+         fmpz_swap(den, rden);
+
+         fmpz_clear(rden);
+      }
+   }
+
+   return len - 1;
+}
+
+void nf_elem_mul_vec(nf_elem_struct * a, const nf_elem_struct * b,
+                     const nf_elem_struct * c, slong n, const nf_t nf)
+{
+   slong i;
+
+   if (n <= 0)
+      return;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      for (i = 0; i < n; i++)
+         _fmpq_mul(LNF_ELEM_NUMREF(a + i), LNF_ELEM_DENREF(a + i),
+                   LNF_ELEM_NUMREF(b + i), LNF_ELEM_DENREF(b + i),
+                   LNF_ELEM_NUMREF(c + i), LNF_ELEM_DENREF(c + i));
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      nf_elem_t t;
+
+      nf_elem_init(t, nf);
+
+      for (i = 0; i < n; i++)
+      {
+         if (a + i == b + i || a + i == c + i)
+         {
+            _nf_elem_mul_red(t, b + i, c + i, nf, 1);
+            nf_elem_swap(t, a + i, nf);
+         } else
+            _nf_elem_mul_red(a + i, b + i, c + i, nf, 1);
+
+         nf_elem_canonicalise(a + i, nf);
+      }
+
+      nf_elem_clear(t, nf);
+   } else /* generic nf_elem */
+   {
+      const slong len = nf->pol->length;
+      const slong plen = 2*len - 3;
+      fmpz * prod, * q, * r;
+      mp_ptr arr = NULL;
+      slong rlen, alloc = 0;
+      fmpz_t den;
+
+      /* scratch space shared by all products */
+      prod = _fmpz_vec_init(plen);
+      fmpz_init(den);
+
+      if (!_nf_use_powers(nf))
+      {
+         q = _fmpz_vec_init(len - 2);
+         r = _fmpz_vec_init(plen);
+      } else
+      {
+         q = NULL;
+         r = NULL;
+      }
+
+      for (i = 0; i < n; i++)
+      {
+         if (NF_ELEM(b + i)->length == 0 || NF_ELEM(c + i)->length == 0)
+         {
+            nf_elem_zero(a + i, nf);
+            continue;
+         }
+
+         rlen = _nf_elem_mul_vec_generic(prod, den, q, r,
+                                            &arr, &alloc, b + i, c + i, nf);
+
+         fmpq_poly_fit_length(NF_ELEM(a + i), rlen);
+         _fmpz_vec_swap(NF_ELEM_NUMREF(a + i), prod, rlen);
+         fmpz_swap(NF_ELEM_DENREF(a + i), den);
+         _fmpq_poly_set_length(NF_ELEM(a + i), rlen);
+         _fmpq_poly_normalise(NF_ELEM(a + i));
+         fmpq_poly_canonicalise(NF_ELEM(a + i));
+      }
+
+      _fmpz_vec_clear(prod, plen);
+      fmpz_clear(den);
+      flint_free(arr);
+
+      if (!_nf_use_powers(nf))
+      {
+         _fmpz_vec_clear(q, len - 2);
+         _fmpz_vec_clear(r, plen);
+      }
+   }
+}
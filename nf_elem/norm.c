@@ -17,6 +17,16 @@
 #include "flint/fmpq.h"
 #include "nf_elem.h"
 
+/*
+   The resultant over Q is computed with a single modular algorithm. For
+   large degree it pays to use word sized primes directly, which can be
+   processed in parallel.
+*/
+static int _nf_elem_norm_use_modular(const nf_elem_t a, const nf_t nf)
+{
+   return fmpq_poly_degree(nf->pol) >= 16 && NF_ELEM(a)->length > 1;
+}
+
 void _nf_elem_norm(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
 {
    if (nf->flag & NF_LINEAR)
@@ -87,6 +97,13 @@ void _nf_elem_norm(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
          return;
       }
 
+      if (_nf_elem_norm_use_modular(a, nf))
+      {
+         _nf_elem_norm_modular(rnum, rden, a, nf);
+
+         return;
+      }
+
       fmpz_init_set_ui(one, 1);
       fmpz_init(pow);
 
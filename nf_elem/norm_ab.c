@@ -0,0 +1,243 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "flint/fmpq.h"
+#include "nf_elem.h"
+
+/* approximate log_2 |F(a, b)/l| given the number of bits of F(a, b) */
+static unsigned char
+_nf_elem_norm_ab_log(slong bits, slong lbits)
+{
+   if (bits == 0)
+      return 0;
+
+   bits -= lbits;
+
+   return bits <= 0 ? 0 : (bits >= 255 ? 255 : bits);
+}
+
+/*
+   Set res[k] and/or logs[k] to F(a0 + k, b), respectively to its
+   approximate logarithm, for 0 <= k < num, where F is the homogenisation
+   of the numerator of the defining polynomial. The values of the degree d
+   polynomial F(x, b) are updated with d additions per point using the
+   forward differences at a0. If the bound 2^sbits (|a| + |b|)^d for F fits
+   in one or two words these additions are done in wrapping word or double
+   word arithmetic, which is exact as the final values fit.
+*/
+static void
+_nf_elem_norm_ab_row(fmpz * res, unsigned char * logs, slong a0, slong num,
+                     slong b, const nf_t nf, slong sbits, slong lbits)
+{
+   const slong len = nf->pol->length, d = len - 1;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   fmpz * g, * v;
+   fmpz_t t, x;
+   ulong m;
+   slong i, j, k, bits;
+
+   if (num <= 0)
+      return;
+
+   g = _fmpz_vec_init(len);
+   v = _fmpz_vec_init(len);
+   fmpz_init(t);
+   fmpz_init(x);
+
+   /* F(x, b) = sum_i f_i b^(d - i) x^i */
+   fmpz_one(t);
+   for (i = d; i >= 0; i--)
+   {
+      fmpz_mul(g + i, fnum + i, t);
+      fmpz_mul_si(t, t, b);
+   }
+
+   /* forward differences of F(x, b) at a0 */
+   for (k = 0; k <= d; k++)
+   {
+      fmpz_set_si(x, a0 + k);
+      _fmpz_poly_evaluate_fmpz(v + k, g, len, x);
+   }
+
+   for (j = 1; j <= d; j++)
+      for (k = d; k >= j; k--)
+         fmpz_sub(v + k, v + k, v + k - 1);
+
+   m = FLINT_MAX(FLINT_ABS(a0), FLINT_ABS(a0 + num - 1));
+   m = FLINT_MAX(m, FLINT_ABS(b));
+   bits = sbits + d*FLINT_BIT_COUNT(m);
+
+   if (bits <= FLINT_BITS - 1) /* word arithmetic */
+   {
+      mp_ptr w = _nmod_vec_init(len);
+
+      for (j = 0; j <= d; j++)
+      {
+         fmpz_fdiv_r_2exp(t, v + j, FLINT_BITS);
+         w[j] = fmpz_get_ui(t);
+      }
+
+      for (k = 0; k < num; k++)
+      {
+         if (res != NULL)
+            fmpz_set_si(res + k, (slong) w[0]);
+
+         if (logs != NULL)
+            logs[k] = _nf_elem_norm_ab_log(
+                    FLINT_BIT_COUNT(FLINT_ABS((slong) w[0])), lbits);
+
+         for (j = 0; j < d; j++)
+            w[j] += w[j + 1];
+      }
+
+      _nmod_vec_clear(w);
+   } else if (bits <= 2*FLINT_BITS - 1) /* double word arithmetic */
+   {
+      mp_ptr w = _nmod_vec_init(2*len);
+      mp_limb_t hi, lo;
+
+      for (j = 0; j <= d; j++)
+      {
+         fmpz_fdiv_r_2exp(t, v + j, 2*FLINT_BITS);
+         w[2*j] = fmpz_get_ui(t);
+         fmpz_fdiv_q_2exp(t, t, FLINT_BITS);
+         w[2*j + 1] = fmpz_get_ui(t);
+      }
+
+      for (k = 0; k < num; k++)
+      {
+         hi = w[1];
+         lo = w[0];
+
+         if ((slong) hi < 0)
+            sub_ddmmss(hi, lo, UWORD(0), UWORD(0), hi, lo);
+
+         if (res != NULL)
+         {
+            fmpz_set_uiui(res + k, hi, lo);
+            if ((slong) w[1] < 0)
+               fmpz_neg(res + k, res + k);
+         }
+
+         if (logs != NULL)
+            logs[k] = _nf_elem_norm_ab_log(hi != 0 ?
+                FLINT_BITS + FLINT_BIT_COUNT(hi) : FLINT_BIT_COUNT(lo), lbits);
+
+         for (j = 0; j < d; j++)
+            add_ssaaaa(w[2*j + 1], w[2*j], w[2*j + 1], w[2*j],
+                                           w[2*j + 3], w[2*j + 2]);
+      }
+
+      _nmod_vec_clear(w);
+   } else /* multiprecision */
+   {
+      for (k = 0; k < num; k++)
+      {
+         if (res != NULL)
+            fmpz_set(res + k, v + 0);
+
+         if (logs != NULL)
+            logs[k] = _nf_elem_norm_ab_log(fmpz_bits(v + 0), lbits);
+
+         for (j = 0; j < d; j++)
+            fmpz_add(v + j, v + j, v + j + 1);
+      }
+   }
+
+   _fmpz_vec_clear(g, len);
+   _fmpz_vec_clear(v, len);
+   fmpz_clear(t);
+   fmpz_clear(x);
+}
+
+/* bits of sum_i |f_i| */
+static slong
+_nf_elem_norm_ab_sbits(const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   fmpz_t s;
+   slong i, bits;
+
+   fmpz_init(s);
+
+   for (i = 0; i < len; i++)
+   {
+      if (fmpz_sgn(fmpq_poly_numref(nf->pol) + i) >= 0)
+         fmpz_add(s, s, fmpq_poly_numref(nf->pol) + i);
+      else
+         fmpz_sub(s, s, fmpq_poly_numref(nf->pol) + i);
+   }
+
+   bits = fmpz_bits(s);
+
+   fmpz_clear(s);
+
+   return bits;
+}
+
+void _nf_elem_norm_ab(fmpz * res, slong a0, slong alen,
+                                slong b0, slong blen, const nf_t nf)
+{
+   const slong sbits = _nf_elem_norm_ab_sbits(nf);
+   slong i;
+
+   for (i = 0; i < blen; i++)
+      _nf_elem_norm_ab_row(res + i*alen, NULL, a0, alen, b0 + i,
+                                                          nf, sbits, 0);
+}
+
+void nf_elem_norm_ab(fmpq * res, slong a0, slong alen,
+                                slong b0, slong blen, const nf_t nf)
+{
+   const fmpz * const lead = fmpq_poly_numref(nf->pol) + nf->pol->length - 1;
+   const slong sbits = _nf_elem_norm_ab_sbits(nf);
+   fmpz * t;
+   slong i, j;
+
+   t = _fmpz_vec_init(alen);
+
+   /* N(a - b theta) = F(a, b)/lead(f) */
+   for (i = 0; i < blen; i++)
+   {
+      _nf_elem_norm_ab_row(t, NULL, a0, alen, b0 + i, nf, sbits, 0);
+
+      for (j = 0; j < alen; j++)
+      {
+         fmpq * r = res + i*alen + j;
+
+         fmpz_swap(fmpq_numref(r), t + j);
+
+         if (nf->flag & NF_MONIC)
+            fmpz_one(fmpq_denref(r));
+         else
+         {
+            fmpz_set(fmpq_denref(r), lead);
+            fmpq_canonicalise(r);
+         }
+      }
+   }
+
+   _fmpz_vec_clear(t, alen);
+}
+
+void nf_elem_norm_ab_log(unsigned char * res, slong a0, slong alen,
+                                slong b0, slong blen, const nf_t nf)
+{
+   const fmpz * const lead = fmpq_poly_numref(nf->pol) + nf->pol->length - 1;
+   const slong sbits = _nf_elem_norm_ab_sbits(nf);
+   const slong lbits = fmpz_bits(lead) - 1;
+   slong i;
+
+   for (i = 0; i < blen; i++)
+      _nf_elem_norm_ab_row(NULL, res + i*alen, a0, alen, b0 + i,
+                                                       nf, sbits, lbits);
+}
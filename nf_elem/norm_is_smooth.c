@@ -0,0 +1,307 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "flint/fmpz_factor.h"
+#include "flint/nmod_poly.h"
+#include "nf_elem.h"
+
+/* numerator and length of the numerator of a */
+static void
+_nf_elem_norm_is_smooth_get(const fmpz ** anum, slong * alen,
+                                          const nf_elem_t a, const nf_t nf)
+{
+   if (nf->flag & NF_LINEAR)
+   {
+      *anum = LNF_ELEM_NUMREF(a);
+      *alen = 1;
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      *anum = QNF_ELEM_NUMREF(a);
+      *alen = 2;
+   } else
+   {
+      *anum = NF_ELEM_NUMREF(a);
+      *alen = NF_ELEM(a)->length;
+   }
+
+   while (*alen > 0 && fmpz_is_zero(*anum + *alen - 1))
+      (*alen)--;
+}
+
+/*
+   Return Res(f, a) modulo p, where the resultant is taken with respect to
+   the degrees flen - 1 and alen - 1 of f and a over Z, given the images
+   {fp, flen} and {ap, alen} of f and a, which need not be normalised.
+*/
+static mp_limb_t
+_nf_elem_norm_is_smooth_res(mp_srcptr fp, slong flen,
+                                  mp_srcptr ap, slong alen, nmod_t mod)
+{
+   slong fl = flen, al = alen;
+   mp_limb_t r;
+
+   while (fl > 0 && fp[fl - 1] == 0)
+      fl--;
+
+   while (al > 0 && ap[al - 1] == 0)
+      al--;
+
+   if (fl == 0 || al == 0)
+      return 0;
+
+   if (fl == flen)
+   {
+      /* Res(f, a) = lead(f)^(deg(a) - deg(a mod p)) Res(f, a mod p) */
+      r = _nmod_poly_resultant(fp, fl, ap, al, mod);
+
+      if (al < alen)
+         r = nmod_mul(r, n_powmod2_ui_preinv(fp[fl - 1], alen - al,
+                                                  mod.n, mod.ninv), mod);
+   } else if (al == alen)
+   {
+      /* Res(f, a) = (-1)^(deg(f) deg(a)) lead(a)^(...) Res(a, f mod p) */
+      if (al >= fl)
+         r = _nmod_poly_resultant(ap, al, fp, fl, mod);
+      else
+      {
+         r = _nmod_poly_resultant(fp, fl, ap, al, mod);
+         if (((fl - 1)*(al - 1)) & 1)
+            r = nmod_neg(r, mod);
+      }
+
+      r = nmod_mul(r, n_powmod2_ui_preinv(ap[al - 1], flen - fl,
+                                                  mod.n, mod.ninv), mod);
+
+      if (((flen - 1)*(alen - 1)) & 1)
+         r = nmod_neg(r, mod);
+   } else /* the first column of the Sylvester matrix vanishes */
+      r = 0;
+
+   return r;
+}
+
+/*
+   Q = Res(f, a)/divisor modulo p, which must not divide divisor, given the
+   image {fp, flen} of f modulo p
+*/
+static mp_limb_t
+_nf_elem_norm_is_smooth_mod(mp_srcptr fp, slong flen, mp_ptr ap,
+         const fmpz * anum, slong alen, const fmpz_t divisor, nmod_t mod)
+{
+   mp_limb_t r;
+   slong i;
+
+   for (i = 0; i < alen; i++)
+      ap[i] = fmpz_fdiv_ui(anum + i, mod.n);
+
+   r = _nf_elem_norm_is_smooth_res(fp, flen, ap, alen, mod);
+
+   if (divisor != NULL)
+      r = nmod_mul(r, n_invmod(fmpz_fdiv_ui(divisor, mod.n), mod.n), mod);
+
+   return r;
+}
+
+/*
+   Set S to the indices of the primes dividing Res(f, a) or the divisor and
+   return their number. The coefficients of f, a and the divisor are
+   reduced modulo all the primes at once using a remainder tree.
+*/
+static slong
+_nf_elem_norm_is_smooth_find(slong * S, const mp_limb_t * primes,
+          slong num_primes, const fmpz * fnum, slong flen,
+          const fmpz * anum, slong alen, const fmpz_t divisor)
+{
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   mp_ptr fres, ares, dres, fp, ap;
+   nmod_t mod;
+   slong i, j, num_S = 0;
+
+   fres = _nmod_vec_init(flen*num_primes);
+   ares = _nmod_vec_init(alen*num_primes);
+   dres = _nmod_vec_init(num_primes);
+   fp = _nmod_vec_init(flen);
+   ap = _nmod_vec_init(alen);
+
+   fmpz_comb_init(comb, primes, num_primes);
+   fmpz_comb_temp_init(comb_temp, comb);
+
+   for (j = 0; j < flen; j++)
+      fmpz_multi_mod_ui(fres + j*num_primes, fnum + j, comb, comb_temp);
+
+   for (j = 0; j < alen; j++)
+      fmpz_multi_mod_ui(ares + j*num_primes, anum + j, comb, comb_temp);
+
+   if (divisor != NULL)
+      fmpz_multi_mod_ui(dres, divisor, comb, comb_temp);
+
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   for (i = 0; i < num_primes; i++)
+   {
+      if (divisor != NULL && dres[i] == 0)
+      {
+         S[num_S++] = i;
+         continue;
+      }
+
+      for (j = 0; j < flen; j++)
+         fp[j] = fres[j*num_primes + i];
+
+      for (j = 0; j < alen; j++)
+         ap[j] = ares[j*num_primes + i];
+
+      nmod_init(&mod, primes[i]);
+
+      if (_nf_elem_norm_is_smooth_res(fp, flen, ap, alen, mod) == 0)
+         S[num_S++] = i;
+   }
+
+   _nmod_vec_clear(fres);
+   _nmod_vec_clear(ares);
+   _nmod_vec_clear(dres);
+   _nmod_vec_clear(fp);
+   _nmod_vec_clear(ap);
+
+   return num_S;
+}
+
+int nf_elem_norm_is_smooth(fmpz_factor_t fac, const nf_elem_t a,
+        const nf_t nf, const mp_limb_t * primes, slong num_primes,
+                                        const fmpz_t divisor, slong nbits)
+{
+   const slong flen = nf->pol->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   const fmpz * anum;
+   mp_limb_t * crt_primes, * residues, p;
+   nf_nmod_struct * crt_mods;
+   slong * S;
+   mp_ptr ap;
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   fmpz_t Q, pz;
+   slong i, e, alen, bound, num_S, num_crt;
+   int smooth = 0;
+
+   _nf_elem_norm_is_smooth_get(&anum, &alen, a, nf);
+
+   if (alen == 0)
+      return 0;
+
+   ap = _nmod_vec_init(alen);
+   S = (slong *) flint_malloc(num_primes*sizeof(slong));
+
+   /*
+      Find the primes of the factor base dividing Q = Res(f, a)/divisor
+      using one word sized resultant each. Primes dividing the divisor can
+      not be decided this way and are kept.
+   */
+   num_S = (num_primes == 0) ? 0 : _nf_elem_norm_is_smooth_find(S, primes,
+                          num_primes, fnum, flen, anum, alen, divisor);
+
+   /* bound for |Q| */
+   if (divisor != NULL)
+      bound = nbits + 2;
+   else
+   {
+      slong fbits, abits;
+
+      fbits = FLINT_ABS(_fmpz_vec_max_bits(fnum, flen))
+            + FLINT_BIT_COUNT(flen);
+      abits = FLINT_ABS(_fmpz_vec_max_bits(anum, alen))
+            + FLINT_BIT_COUNT(alen);
+      bound = (alen - 1)*fbits + (flen - 1)*abits + 2;
+   }
+
+   num_crt = (bound + FLINT_BITS - 2)/(FLINT_BITS - 1);
+
+   crt_primes = (mp_limb_t *) flint_malloc(num_crt*sizeof(mp_limb_t));
+   crt_mods = (nf_nmod_struct *) flint_malloc(num_crt*sizeof(nf_nmod_struct));
+   residues = (mp_limb_t *) flint_malloc(num_crt*sizeof(mp_limb_t));
+
+   /* images of f modulo primes not dividing its leading coefficient */
+   p = UWORD(1) << (FLINT_BITS - 1);
+
+   for (i = 0; i < num_crt; )
+   {
+      p = n_nextprime(p, 0);
+      _nf_nmod_init(crt_mods + i, nf, p);
+
+      if (crt_mods[i].pol->length == flen
+       && (divisor == NULL || fmpz_fdiv_ui(divisor, p) != 0))
+         crt_primes[i++] = p;
+      else
+         _nf_nmod_clear(crt_mods + i);
+   }
+
+   /*
+      If no prime of the factor base divides Q it is only smooth if it is
+      a unit, which is usually refuted by the first image.
+   */
+   residues[0] = _nf_elem_norm_is_smooth_mod(crt_mods[0].pol->coeffs, flen,
+                           ap, anum, alen, divisor, crt_mods[0].pol->mod);
+
+   if (num_S == 0 && residues[0] != 1 && residues[0] != crt_primes[0] - 1)
+      goto cleanup;
+
+   /* recover Q and divide out the primes found above */
+   for (i = 1; i < num_crt; i++)
+      residues[i] = _nf_elem_norm_is_smooth_mod(crt_mods[i].pol->coeffs,
+                     flen, ap, anum, alen, divisor, crt_mods[i].pol->mod);
+
+   fmpz_init(Q);
+   fmpz_init(pz);
+
+   fmpz_comb_init(comb, crt_primes, num_crt);
+   fmpz_comb_temp_init(comb_temp, comb);
+
+   fmpz_multi_CRT_ui(Q, residues, comb, comb_temp, 1);
+
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   if (!fmpz_is_zero(Q))
+   {
+      fac->num = 0;
+      fac->sign = fmpz_sgn(Q);
+      fmpz_abs(Q, Q);
+
+      for (i = 0; i < num_S; i++)
+      {
+         fmpz_set_ui(pz, primes[S[i]]);
+         e = fmpz_remove(Q, Q, pz);
+
+         if (e > 0)
+            _fmpz_factor_append_ui(fac, primes[S[i]], e);
+      }
+
+      smooth = fmpz_is_one(Q);
+   }
+
+   fmpz_clear(Q);
+   fmpz_clear(pz);
+
+cleanup:
+
+   for (i = 0; i < num_crt; i++)
+      _nf_nmod_clear(crt_mods + i);
+
+   _nmod_vec_clear(ap);
+   flint_free(S);
+   flint_free(crt_primes);
+   flint_free(crt_mods);
+   flint_free(residues);
+
+   return smooth;
+}
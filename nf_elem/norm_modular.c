@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "flint/fmpq.h"
+#include "flint/nmod_poly.h"
+#include "flint/thread_support.h"
+#include "nf_elem.h"
+
+/* minimum number of primes handled by each thread */
+#define NF_ELEM_NORM_MODULAR_THREAD_CUTOFF 8
+
+typedef struct
+{
+   mp_limb_t * res;
+   const nf_nmod_struct * mods;
+   slong num;
+   const fmpz * anum;
+   slong alen;
+} _norm_worker_arg_struct;
+
+/* compute Res(f, a) modulo each of a block of primes */
+static void
+_nf_elem_norm_modular_worker(void * varg)
+{
+   _norm_worker_arg_struct * arg = (_norm_worker_arg_struct *) varg;
+   nmod_poly_t ap;
+   slong i, j;
+
+   for (i = 0; i < arg->num; i++)
+   {
+      const nf_nmod_struct * mod = arg->mods + i;
+
+      nmod_poly_init2(ap, mod->n, arg->alen);
+
+      for (j = 0; j < arg->alen; j++)
+         ap->coeffs[j] = fmpz_fdiv_ui(arg->anum + j, mod->n);
+      _nmod_poly_set_length(ap, arg->alen);
+
+      arg->res[i] = nmod_poly_resultant(mod->pol, ap);
+
+      nmod_poly_clear(ap);
+   }
+}
+
+void _nf_elem_norm_modular(fmpz_t rnum, fmpz_t rden,
+                                        const nf_elem_t a, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   const slong alen = NF_ELEM(a)->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   const fmpz * const anum = NF_ELEM_NUMREF(a);
+   thread_pool_handle * threads;
+   _norm_worker_arg_struct * args;
+   nf_nmod_struct * mods;
+   mp_limb_t * primes, * res, p;
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   fmpz_t t;
+   slong fbits, abits, bound, num_primes, num_threads, num_workers, i, start;
+
+   if (alen == 0)
+   {
+      fmpz_zero(rnum);
+      fmpz_one(rden);
+
+      return;
+   }
+
+   /*
+      Hadamard bound for the Sylvester matrix, |Res(f, a)| <= |f|^deg(a)
+      |a|^deg(f), plus one bit for the sign.
+   */
+   fbits = FLINT_ABS(_fmpz_vec_max_bits(fnum, len)) + FLINT_BIT_COUNT(len);
+   abits = FLINT_ABS(_fmpz_vec_max_bits(anum, alen)) + FLINT_BIT_COUNT(alen);
+   bound = (alen - 1)*fbits + (len - 1)*abits + 2;
+
+   /*
+      Primes dividing a leading coefficient are skipped so that the
+      resultant modulo p is the image of the resultant over Z.
+   */
+   num_primes = (bound + FLINT_BITS - 2)/(FLINT_BITS - 1);
+
+   primes = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+   res = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+   mods = (nf_nmod_struct *) flint_malloc(num_primes*sizeof(nf_nmod_struct));
+
+   /* images of f, computed before any threads start */
+   p = UWORD(1) << (FLINT_BITS - 1);
+
+   for (i = 0; i < num_primes; )
+   {
+      p = n_nextprime(p, 0);
+      _nf_nmod_init(mods + i, nf, p);
+
+      if (mods[i].pol->length == len && fmpz_fdiv_ui(anum + alen - 1, p) != 0)
+         primes[i++] = p;
+      else
+         _nf_nmod_clear(mods + i);
+   }
+
+   /* compute the images, in parallel if there are enough primes */
+   num_threads = FLINT_MIN(flint_get_num_threads(),
+                              num_primes/NF_ELEM_NORM_MODULAR_THREAD_CUTOFF);
+
+   num_workers = flint_request_threads(&threads, FLINT_MAX(num_threads, 1));
+
+   args = (_norm_worker_arg_struct *)
+            flint_malloc((num_workers + 1)*sizeof(_norm_worker_arg_struct));
+
+   start = 0;
+   for (i = 0; i <= num_workers; i++)
+   {
+      slong end = ((i + 1)*num_primes)/(num_workers + 1);
+
+      args[i].res = res + start;
+      args[i].mods = mods + start;
+      args[i].num = end - start;
+      args[i].anum = anum;
+      args[i].alen = alen;
+
+      start = end;
+   }
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wake(global_thread_pool, threads[i], 0,
+                                     _nf_elem_norm_modular_worker, &args[i]);
+
+   _nf_elem_norm_modular_worker(&args[num_workers]);
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wait(global_thread_pool, threads[i]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   /* Res(f, a) by Chinese remaindering, with a symmetric remainder */
+   fmpz_comb_init(comb, primes, num_primes);
+   fmpz_comb_temp_init(comb_temp, comb);
+
+   fmpz_multi_CRT_ui(rnum, res, comb, comb_temp, 1);
+
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   /* N(a) = Res(f, num(a))/(lead(f)^deg(a) den(a)^deg(f)) */
+   fmpz_init(t);
+
+   fmpz_pow_ui(rden, fnum + len - 1, alen - 1);
+   fmpz_pow_ui(t, NF_ELEM_DENREF(a), len - 1);
+   fmpz_mul(rden, rden, t);
+
+   _fmpq_canonicalise(rnum, rden);
+
+   fmpz_clear(t);
+
+   for (i = 0; i < num_primes; i++)
+      _nf_nmod_clear(mods + i);
+
+   flint_free(primes);
+   flint_free(res);
+   flint_free(mods);
+   flint_free(args);
+}
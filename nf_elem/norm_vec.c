@@ -0,0 +1,325 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_vec.h"
+#include "flint/fmpq.h"
+#include "flint/nmod_poly.h"
+#include "flint/thread_support.h"
+#include "nf_elem.h"
+
+/* minimum number of elements handled by each thread */
+#define NF_ELEM_NORM_VEC_THREAD_CUTOFF 64
+
+typedef struct
+{
+   mp_ptr res;
+   const nf_elem_struct * a;
+   slong len;
+   mp_srcptr * fmod;
+   const nmod_t * mods;
+   slong num_primes;
+   const nf_struct * nf;
+} _norm_vec_worker_arg_struct;
+
+/* numerator, denominator and length of the numerator of a */
+static void
+_nf_elem_norm_vec_get(const fmpz ** anum, const fmpz ** aden, slong * alen,
+                                          const nf_elem_t a, const nf_t nf)
+{
+   if (nf->flag & NF_LINEAR)
+   {
+      *anum = LNF_ELEM_NUMREF(a);
+      *aden = LNF_ELEM_DENREF(a);
+      *alen = 1;
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      *anum = QNF_ELEM_NUMREF(a);
+      *aden = QNF_ELEM_DENREF(a);
+      *alen = 2;
+   } else
+   {
+      *anum = NF_ELEM_NUMREF(a);
+      *aden = NF_ELEM_DENREF(a);
+      *alen = NF_ELEM(a)->length;
+   }
+
+   while (*alen > 0 && fmpz_is_zero(*anum + *alen - 1))
+      (*alen)--;
+}
+
+/*
+   Set res[i*num_primes + j] to Res(f, num(a_i)) modulo the j-th prime,
+   where the resultant is taken with respect to the degree of num(a_i)
+   over Z. If the degree drops modulo p, the resultant of the image is
+   multiplied by the appropriate power of the leading coefficient of f.
+*/
+static void
+_nf_elem_norm_vec_worker(void * varg)
+{
+   _norm_vec_worker_arg_struct * arg = (_norm_vec_worker_arg_struct *) varg;
+   const slong flen = arg->nf->pol->length;
+   const fmpz * anum, * aden;
+   mp_ptr ap;
+   mp_limb_t r;
+   slong i, j, k, alen, plen;
+
+   ap = _nmod_vec_init(flen);
+
+   for (i = 0; i < arg->len; i++)
+   {
+      _nf_elem_norm_vec_get(&anum, &aden, &alen, arg->a + i, arg->nf);
+
+      for (j = 0; j < arg->num_primes; j++)
+      {
+         const nmod_t mod = arg->mods[j];
+         mp_srcptr fp = arg->fmod[j];
+
+         for (k = 0; k < alen; k++)
+            ap[k] = fmpz_fdiv_ui(anum + k, mod.n);
+
+         plen = alen;
+         while (plen > 0 && ap[plen - 1] == 0)
+            plen--;
+
+         if (plen == 0)
+            r = 0;
+         else
+         {
+            r = _nmod_poly_resultant(fp, flen, ap, plen, mod);
+
+            if (plen < alen)
+               r = nmod_mul(r, n_powmod2_ui_preinv(fp[flen - 1],
+                                     alen - plen, mod.n, mod.ninv), mod);
+         }
+
+         arg->res[i*arg->num_primes + j] = r;
+      }
+   }
+
+   _nmod_vec_clear(ap);
+}
+
+/*
+   Compute the residues of Res(f, num(a_i)) given the images {fmod[j], flen}
+   of f modulo the moduli mods[j], none of which may divide the leading
+   coefficient of f. The batch is split between the available threads.
+*/
+static void
+_nf_elem_norm_vec_residues(mp_ptr res, const nf_elem_struct * a, slong len,
+         mp_srcptr * fmod, const nmod_t * mods, slong num_primes, const nf_t nf)
+{
+   thread_pool_handle * threads;
+   _norm_vec_worker_arg_struct * args;
+   slong i, start, num_threads, num_workers;
+
+   num_threads = FLINT_MIN(flint_get_num_threads(),
+                                   len/NF_ELEM_NORM_VEC_THREAD_CUTOFF);
+
+   num_workers = flint_request_threads(&threads, FLINT_MAX(num_threads, 1));
+
+   args = (_norm_vec_worker_arg_struct *)
+            flint_malloc((num_workers + 1)*sizeof(_norm_vec_worker_arg_struct));
+
+   start = 0;
+   for (i = 0; i <= num_workers; i++)
+   {
+      slong end = ((i + 1)*len)/(num_workers + 1);
+
+      args[i].res = res + start*num_primes;
+      args[i].a = a + start;
+      args[i].len = end - start;
+      args[i].fmod = fmod;
+      args[i].mods = mods;
+      args[i].num_primes = num_primes;
+      args[i].nf = nf;
+
+      start = end;
+   }
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wake(global_thread_pool, threads[i], 0,
+                                      _nf_elem_norm_vec_worker, &args[i]);
+
+   _nf_elem_norm_vec_worker(&args[num_workers]);
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wait(global_thread_pool, threads[i]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   flint_free(args);
+}
+
+void nf_elem_norm_vec(fmpq * res, const nf_elem_struct * a,
+                                                  slong len, const nf_t nf)
+{
+   const slong flen = nf->pol->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   const fmpz * anum, * aden;
+   mp_limb_t * primes, * residues, p;
+   mp_ptr * fmod;
+   nmod_t * mods;
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   fmpz_t t;
+   slong i, j, alen, fbits, abits, maxlen, bound, num_primes;
+
+   if (len == 0)
+      return;
+
+   /* Hadamard bound for Res(f, num(a_i)) over the whole batch */
+   fbits = FLINT_ABS(_fmpz_vec_max_bits(fnum, flen)) + FLINT_BIT_COUNT(flen);
+
+   abits = 0;
+   maxlen = 0;
+   for (i = 0; i < len; i++)
+   {
+      _nf_elem_norm_vec_get(&anum, &aden, &alen, a + i, nf);
+
+      abits = FLINT_MAX(abits, FLINT_ABS(_fmpz_vec_max_bits(anum, alen)));
+      maxlen = FLINT_MAX(maxlen, alen);
+   }
+
+   abits += FLINT_BIT_COUNT(maxlen);
+   bound = FLINT_MAX(maxlen - 1, 0)*fbits + (flen - 1)*abits + 2;
+
+   num_primes = (bound + FLINT_BITS - 2)/(FLINT_BITS - 1);
+
+   primes = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+   residues = (mp_limb_t *) flint_malloc(len*num_primes*sizeof(mp_limb_t));
+   fmod = (mp_ptr *) flint_malloc(num_primes*sizeof(mp_ptr));
+   mods = (nmod_t *) flint_malloc(num_primes*sizeof(nmod_t));
+
+   /* images of f modulo primes not dividing its leading coefficient */
+   p = UWORD(1) << (FLINT_BITS - 1);
+
+   for (i = 0; i < num_primes; )
+   {
+      p = n_nextprime(p, 0);
+
+      if (fmpz_fdiv_ui(fnum + flen - 1, p) != 0)
+      {
+         nmod_init(mods + i, p);
+
+         fmod[i] = _nmod_vec_init(flen);
+         for (j = 0; j < flen; j++)
+            fmod[i][j] = fmpz_fdiv_ui(fnum + j, p);
+
+         primes[i++] = p;
+      }
+   }
+
+   _nf_elem_norm_vec_residues(residues, a, len,
+                              (mp_srcptr *) fmod, mods, num_primes, nf);
+
+   /* N(a_i) = Res(f, num(a_i))/(lead(f)^deg(a_i) den(a_i)^deg(f)) */
+   fmpz_comb_init(comb, primes, num_primes);
+   fmpz_comb_temp_init(comb_temp, comb);
+   fmpz_init(t);
+
+   for (i = 0; i < len; i++)
+   {
+      _nf_elem_norm_vec_get(&anum, &aden, &alen, a + i, nf);
+
+      if (alen == 0)
+      {
+         fmpq_zero(res + i);
+         continue;
+      }
+
+      fmpz_multi_CRT_ui(fmpq_numref(res + i), residues + i*num_primes,
+                                                     comb, comb_temp, 1);
+
+      fmpz_pow_ui(fmpq_denref(res + i), fnum + flen - 1, alen - 1);
+      fmpz_pow_ui(t, aden, flen - 1);
+      fmpz_mul(fmpq_denref(res + i), fmpq_denref(res + i), t);
+
+      fmpq_canonicalise(res + i);
+   }
+
+   fmpz_clear(t);
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   for (j = 0; j < num_primes; j++)
+      _nmod_vec_clear(fmod[j]);
+
+   flint_free(primes);
+   flint_free(residues);
+   flint_free(fmod);
+   flint_free(mods);
+}
+
+void nf_elem_norm_vec_mod(fmpz * res, const nf_elem_struct * a, slong len,
+                 const mp_limb_t * primes, slong num_primes, const nf_t nf)
+{
+   const slong flen = nf->pol->length;
+   const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+   mp_limb_t * residues;
+   mp_ptr * fmod;
+   nmod_t * mods;
+   fmpz_comb_t comb;
+   fmpz_comb_temp_t comb_temp;
+   slong i, j;
+
+   if (len == 0)
+      return;
+
+   if (num_primes == 0)
+   {
+      _fmpz_vec_zero(res, len);
+      return;
+   }
+
+   for (i = 0; i < num_primes; i++)
+   {
+      if (fmpz_fdiv_ui(fnum + flen - 1, primes[i]) == 0)
+      {
+         flint_printf("Exception (nf_elem_norm_vec_mod). Prime divides leading\n");
+         flint_printf("coefficient of defining polynomial.\n");
+         abort();
+      }
+   }
+
+   residues = (mp_limb_t *) flint_malloc(len*num_primes*sizeof(mp_limb_t));
+
+   /* images of f modulo the given primes */
+   fmod = (mp_ptr *) flint_malloc(num_primes*sizeof(mp_ptr));
+   mods = (nmod_t *) flint_malloc(num_primes*sizeof(nmod_t));
+
+   for (j = 0; j < num_primes; j++)
+   {
+      nmod_init(mods + j, primes[j]);
+
+      fmod[j] = _nmod_vec_init(flen);
+      for (i = 0; i < flen; i++)
+         fmod[j][i] = fmpz_fdiv_ui(fnum + i, primes[j]);
+   }
+
+   _nf_elem_norm_vec_residues(residues, a, len,
+                              (mp_srcptr *) fmod, mods, num_primes, nf);
+
+   fmpz_comb_init(comb, primes, num_primes);
+   fmpz_comb_temp_init(comb_temp, comb);
+
+   for (i = 0; i < len; i++)
+      fmpz_multi_CRT_ui(res + i, residues + i*num_primes, comb, comb_temp, 0);
+
+   fmpz_comb_temp_clear(comb_temp);
+   fmpz_comb_clear(comb);
+
+   for (j = 0; j < num_primes; j++)
+      _nmod_vec_clear(fmod[j]);
+
+   flint_free(fmod);
+   flint_free(mods);
+   flint_free(residues);
+}
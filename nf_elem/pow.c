@@ -100,6 +100,219 @@ _nf_elem_pow(nf_elem_t res, const nf_elem_t a, ulong e, const nf_t nf)
     nf_elem_clear(v, nf);
 }
 
+/*
+   Set {rnum, 2} to (m0 + m1*y)^e, where y is a root of y^2 + c1*y + c0 and
+   m0 + m1*y has norm Q = +-1 and the discriminant disc = c1^2 - 4*c0 is
+   nonzero. We use the Lucas sequence V_k = b^k + b'^k, where b' is the
+   conjugate, so that each bit of e costs one squaring and one
+   multiplication instead of three multiplications.
+*/
+static void
+_nf_elem_pow_quadratic_lucas(fmpz * rnum, const fmpz_t m0, const fmpz_t m1,
+            const fmpz_t c1, const fmpz_t disc, int Q, ulong e)
+{
+   fmpz_t P, D, V0, V1, t;
+   slong i;
+   int odd = 0, s0, s1;
+
+   fmpz_init(P);
+   fmpz_init(D);
+   fmpz_init_set_ui(V0, 2);
+   fmpz_init(V1);
+   fmpz_init(t);
+
+   /* P = b + b' = 2*m0 - c1*m1 */
+   fmpz_mul_2exp(P, m0, 1);
+   fmpz_submul(P, c1, m1);
+   fmpz_set(V1, P);
+
+   /* (V_k, V_{k + 1}) -> (V_{2k}, V_{2k + 1}) or (V_{2k + 1}, V_{2k + 2}) */
+   for (i = FLINT_BIT_COUNT(e) - 1; i >= 0; i--)
+   {
+      /* signs of Q^k and Q^{k + 1} */
+      s0 = (Q == 1 || !odd) ? 1 : -1;
+      s1 = (Q == 1 || odd) ? 1 : -1;
+
+      if ((e >> i) & 1)
+      {
+         fmpz_mul(V0, V0, V1);
+         if (s0 == 1)
+            fmpz_sub(V0, V0, P);
+         else
+            fmpz_add(V0, V0, P);
+
+         fmpz_mul(V1, V1, V1);
+         fmpz_sub_ui(V1, V1, 2);
+         if (s1 == -1)
+            fmpz_add_ui(V1, V1, 4);
+
+         odd = 1;
+      } else
+      {
+         fmpz_mul(t, V0, V1);
+         if (s0 == 1)
+            fmpz_sub(V1, t, P);
+         else
+            fmpz_add(V1, t, P);
+
+         fmpz_mul(V0, V0, V0);
+         fmpz_sub_ui(V0, V0, 2);
+         if (s0 == -1)
+            fmpz_add_ui(V0, V0, 4);
+
+         odd = 0;
+      }
+   }
+
+   /*
+      U_e = (b^e - b'^e)/(b - b') = (2*V_{e + 1} - P*V_e)/D where
+      D = (b - b')^2 = m1^2*disc, which is nonzero as m1 != 0
+   */
+   fmpz_mul(D, m1, m1);
+   fmpz_mul(D, D, disc);
+
+   fmpz_mul_2exp(t, V1, 1);
+   fmpz_submul(t, P, V0);
+   fmpz_divexact(t, t, D);
+
+   /* b^e = (V_e + U_e*(b - b'))/2 where b - b' = m1*(2*y + c1) */
+   fmpz_mul(rnum + 1, t, m1);
+   fmpz_mul(t, rnum + 1, c1);
+   fmpz_add(t, t, V0);
+   fmpz_tdiv_q_2exp(rnum, t, 1);
+
+   fmpz_clear(P);
+   fmpz_clear(D);
+   fmpz_clear(V0);
+   fmpz_clear(V1);
+   fmpz_clear(t);
+}
+
+/*
+   Set {rnum, 2} to (m0 + m1*y)^e, where y is a root of y^2 + c1*y + c0, by
+   left-to-right binary exponentiation without any content removal.
+*/
+static void
+_nf_elem_pow_quadratic_binexp(fmpz * rnum, const fmpz_t m0, const fmpz_t m1,
+                              const fmpz_t c0, const fmpz_t c1, ulong e)
+{
+   fmpz * const u = rnum;
+   fmpz * const v = rnum + 1;
+   fmpz_t s, w;
+   slong i;
+
+   fmpz_init(s);
+   fmpz_init(w);
+
+   fmpz_set(u, m0);
+   fmpz_set(v, m1);
+
+   for (i = FLINT_BIT_COUNT(e) - 2; i >= 0; i--)
+   {
+      /* (u + v*y)^2 = (u^2 - c0*v^2) + (2*u*v - c1*v^2)*y */
+      fmpz_mul(w, v, v);
+      fmpz_mul(s, u, v);
+      fmpz_mul_2exp(s, s, 1);
+      fmpz_submul(s, w, c1);
+      fmpz_mul(u, u, u);
+      fmpz_submul(u, w, c0);
+      fmpz_swap(v, s);
+
+      if ((e >> i) & 1)
+      {
+         /* (u + v*y)(m0 + m1*y) */
+         fmpz_mul(w, v, m1);
+         fmpz_mul(s, u, m1);
+         fmpz_addmul(s, v, m0);
+         fmpz_submul(s, w, c1);
+         fmpz_mul(u, u, m0);
+         fmpz_submul(u, w, c0);
+         fmpz_swap(v, s);
+      }
+   }
+
+   fmpz_clear(s);
+   fmpz_clear(w);
+}
+
+/*
+   Powering in a quadratic field Q(x) with x a root of c2*x^2 + c1*x + c0.
+   The element (n0 + n1*x)/d is written as (m0 + m1*y)/(c2*d) where
+   y = c2*x is integral with minimal polynomial y^2 + c1*y + c0*c2. The
+   numerator is powered in Z[y] and the denominator is the exact power
+   (c2*d)^e, so that the content only has to be removed once at the end.
+*/
+static void
+_nf_elem_pow_quadratic(nf_elem_t res, const nf_elem_t a, ulong e,
+                                                               const nf_t nf)
+{
+   const fmpz * const pnum = fmpq_poly_numref(nf->pol);
+   const fmpz * const anum = QNF_ELEM_NUMREF(a);
+   fmpz * const rnum = QNF_ELEM_NUMREF(res);
+   fmpz_t c0, c1, c2, m0, m1, d, Q, disc;
+
+   if (fmpz_is_zero(anum + 1))
+   {
+      fmpz_pow_ui(rnum, anum, e);
+      fmpz_pow_ui(QNF_ELEM_DENREF(res), QNF_ELEM_DENREF(a), e);
+      fmpz_zero(rnum + 1);
+      fmpz_zero(rnum + 2);
+
+      return;
+   }
+
+   fmpz_init_set(c0, pnum);
+   fmpz_init_set(c1, pnum + 1);
+   fmpz_init_set(c2, pnum + 2);
+   fmpz_init(m0);
+   fmpz_init_set(m1, anum + 1);
+   fmpz_init(d);
+   fmpz_init(Q);
+   fmpz_init(disc);
+
+   if (fmpz_sgn(c2) < 0)
+   {
+      fmpz_neg(c0, c0);
+      fmpz_neg(c1, c1);
+      fmpz_neg(c2, c2);
+   }
+
+   fmpz_mul(c0, c0, c2);
+   fmpz_mul(m0, anum, c2);
+   fmpz_mul(d, QNF_ELEM_DENREF(a), c2);
+
+   /* norm of m0 + m1*y */
+   fmpz_mul(Q, m0, m0);
+   fmpz_mul(rnum, m0, m1);
+   fmpz_submul(Q, rnum, c1);
+   fmpz_mul(rnum, m1, m1);
+   fmpz_addmul(Q, rnum, c0);
+
+   fmpz_mul(disc, c1, c1);
+   fmpz_submul_ui(disc, c0, 4);
+
+   if (fmpz_is_pm1(Q) && !fmpz_is_zero(disc))
+      _nf_elem_pow_quadratic_lucas(rnum, m0, m1, c1, disc, fmpz_sgn(Q), e);
+   else
+      _nf_elem_pow_quadratic_binexp(rnum, m0, m1, c0, c1, e);
+
+   /* substitute y = c2*x */
+   fmpz_mul(rnum + 1, rnum + 1, c2);
+   fmpz_zero(rnum + 2);
+   fmpz_pow_ui(QNF_ELEM_DENREF(res), d, e);
+
+   nf_elem_canonicalise(res, nf);
+
+   fmpz_clear(c0);
+   fmpz_clear(c1);
+   fmpz_clear(c2);
+   fmpz_clear(m0);
+   fmpz_clear(m1);
+   fmpz_clear(d);
+   fmpz_clear(Q);
+   fmpz_clear(disc);
+}
+
 void
 nf_elem_pow(nf_elem_t res, const nf_elem_t a, ulong e, const nf_t nf)
 {
@@ -122,7 +335,13 @@ nf_elem_pow(nf_elem_t res, const nf_elem_t a, ulong e, const nf_t nf)
    if (nf->flag & NF_LINEAR)
       _fmpq_pow_si(LNF_ELEM_NUMREF(res), LNF_ELEM_DENREF(res), 
                    LNF_ELEM_NUMREF(a), LNF_ELEM_DENREF(a), e);
-   else
+   else if (nf->flag & NF_QUADRATIC)
+   {
+      if (e == UWORD(1))
+         nf_elem_set(res, a, nf);
+      else
+         _nf_elem_pow_quadratic(res, a, e, nf);
+   } else
    {
       if (e < UWORD(3))
       {
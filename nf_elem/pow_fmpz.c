@@ -0,0 +1,194 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_elem.h"
+
+static slong
+_nf_elem_pow_window_size(mp_bitcnt_t bits)
+{
+   if (bits <= 8)
+      return 1;
+   else if (bits <= 24)
+      return 2;
+   else if (bits <= 69)
+      return 3;
+   else if (bits <= 196)
+      return 4;
+   else if (bits <= 538)
+      return 5;
+   else
+      return 6;
+}
+
+/*
+   Set a to a*b, not canonicalised, using the temporary t. For a generic
+   field the product is not reduced either, as long as its length is at
+   most 2d - 1 so that a single reduction can still be done later; a is
+   only reduced first if the product would be longer. The element b must
+   be reduced, or equal to a.
+*/
+static void
+_nf_elem_pow_mul(nf_elem_t a, const nf_elem_t b, nf_elem_t t, const nf_t nf)
+{
+   if (nf->flag & (NF_LINEAR | NF_QUADRATIC))
+      _nf_elem_mul_red(t, a, b, nf, 1);
+   else
+   {
+      const slong d = fmpq_poly_degree(nf->pol);
+
+      if (NF_ELEM(a)->length + NF_ELEM(b)->length - 1 > 2*d - 1)
+         _nf_elem_reduce(a, nf);
+
+      _nf_elem_mul_red(t, a, b, nf, 0);
+   }
+
+   nf_elem_swap(a, t, nf);
+}
+
+void
+_nf_elem_pow_fmpz(nf_elem_t res, const nf_elem_t a, const fmpz_t e,
+                                                               const nf_t nf)
+{
+   const mp_bitcnt_t bits = fmpz_bits(e);
+   const slong k = _nf_elem_pow_window_size(bits);
+   const slong n = WORD(1) << (k - 1);
+   nf_elem_struct * pw;
+   nf_elem_t t;
+   slong i, j, l;
+   ulong u;
+
+   pw = (nf_elem_struct *) flint_malloc(n*sizeof(nf_elem_struct));
+
+   for (i = 0; i < n; i++)
+      nf_elem_init(pw + i, nf);
+   nf_elem_init(t, nf);
+
+   /* odd powers a, a^3, ..., a^(2^k - 1) */
+   nf_elem_set(pw, a, nf);
+   if (n > 1)
+   {
+      nf_elem_mul(t, a, a, nf);
+
+      for (i = 1; i < n; i++)
+         nf_elem_mul(pw + i, pw + i - 1, t, nf);
+   }
+
+   /*
+      Squarings and multiplications within a window are only reduced modulo
+      the defining polynomial when necessary, and the result is reduced and
+      canonicalised once per window. Runs of zero bits are split into
+      windows of at most k squarings in the same way, so that the content
+      of the unreduced result cannot grow without bound.
+   */
+   i = bits - 1;
+   while (i >= 0)
+   {
+      if (!fmpz_tstbit(e, i))
+      {
+         for (l = 0; l < k && i >= 0 && !fmpz_tstbit(e, i); l++, i--)
+            _nf_elem_pow_mul(res, res, t, nf);
+
+         nf_elem_reduce(res, nf);
+
+         continue;
+      }
+
+      j = FLINT_MAX(i - k + 1, 0);
+      while (!fmpz_tstbit(e, j))
+         j++;
+
+      u = 0;
+      for (l = i; l >= j; l--)
+         u = 2*u + fmpz_tstbit(e, l);
+
+      if (i == bits - 1)
+         nf_elem_set(res, pw + u/2, nf);
+      else
+      {
+         for (l = i; l >= j; l--)
+            _nf_elem_pow_mul(res, res, t, nf);
+
+         _nf_elem_pow_mul(res, pw + u/2, t, nf);
+         nf_elem_reduce(res, nf);
+      }
+
+      i = j - 1;
+   }
+
+   for (i = 0; i < n; i++)
+      nf_elem_clear(pw + i, nf);
+   flint_free(pw);
+
+   nf_elem_clear(t, nf);
+}
+
+void
+nf_elem_pow_fmpz(nf_elem_t res, const nf_elem_t a, const fmpz_t e,
+                                                               const nf_t nf)
+{
+   nf_elem_t t;
+
+   if (fmpz_sgn(e) < 0)
+   {
+      fmpz_t f;
+
+      fmpz_init(f);
+      nf_elem_init(t, nf);
+
+      fmpz_neg(f, e);
+      nf_elem_inv(t, a, nf);
+      nf_elem_pow_fmpz(res, t, f, nf);
+
+      nf_elem_clear(t, nf);
+      fmpz_clear(f);
+
+      return;
+   }
+
+   if (fmpz_is_zero(e))
+   {
+      nf_elem_one(res, nf);
+
+      return;
+   }
+    
+   if (nf_elem_is_zero(a, nf))
+   {
+      nf_elem_zero(res, nf);
+
+      return;
+   }
+
+   if ((nf->flag & (NF_LINEAR | NF_QUADRATIC)) && fmpz_abs_fits_ui(e))
+   {
+      nf_elem_pow(res, a, fmpz_get_ui(e), nf);
+
+      return;
+   }
+
+   if (fmpz_is_one(e))
+   {
+      nf_elem_set(res, a, nf);
+
+      return;
+   }
+
+   if (res == a)
+   {
+      nf_elem_init(t, nf);
+
+      _nf_elem_pow_fmpz(t, a, e, nf);
+      nf_elem_swap(t, res, nf);
+
+      nf_elem_clear(t, nf);
+   }
+   else
+      _nf_elem_pow_fmpz(res, a, e, nf);
+}
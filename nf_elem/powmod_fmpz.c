@@ -0,0 +1,218 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "flint/nmod_poly.h"
+#include "flint/fmpz_mod_poly.h"
+#include "nf_elem.h"
+
+/* set a to the element with numerator {coeffs, len} and denominator 1 */
+static void
+_nf_elem_set_ui_vec(nf_elem_t a, mp_srcptr coeffs, slong len, const nf_t nf)
+{
+   slong i;
+
+   if (nf->flag & NF_QUADRATIC)
+   {
+      fmpz * const anum = QNF_ELEM_NUMREF(a);
+
+      for (i = 0; i < 3; i++)
+         fmpz_set_ui(anum + i, i < len ? coeffs[i] : 0);
+
+      fmpz_one(QNF_ELEM_DENREF(a));
+   } else
+   {
+      fmpq_poly_fit_length(NF_ELEM(a), len);
+
+      for (i = 0; i < len; i++)
+         fmpz_set_ui(NF_ELEM_NUMREF(a) + i, coeffs[i]);
+
+      fmpz_one(NF_ELEM_DENREF(a));
+      _fmpq_poly_set_length(NF_ELEM(a), len);
+   }
+}
+
+/* set a to the element with numerator {coeffs, len} and denominator 1 */
+static void
+_nf_elem_set_fmpz_vec(nf_elem_t a, const fmpz * coeffs, slong len,
+                                                               const nf_t nf)
+{
+   slong i;
+
+   if (nf->flag & NF_QUADRATIC)
+   {
+      fmpz * const anum = QNF_ELEM_NUMREF(a);
+
+      for (i = 0; i < 3; i++)
+      {
+         if (i < len)
+            fmpz_set(anum + i, coeffs + i);
+         else
+            fmpz_zero(anum + i);
+      }
+
+      fmpz_one(QNF_ELEM_DENREF(a));
+   } else
+   {
+      fmpq_poly_fit_length(NF_ELEM(a), len);
+      _fmpz_vec_set(NF_ELEM_NUMREF(a), coeffs, len);
+      fmpz_one(NF_ELEM_DENREF(a));
+      _fmpq_poly_set_length(NF_ELEM(a), len);
+   }
+}
+
+static void
+_nf_elem_powmod_nmod(nf_elem_t res, const nf_elem_t a, const fmpz_t e,
+                                                 mp_limb_t m, const nf_t nf)
+{
+   nf_nmod_struct mod;
+   nmod_poly_t pol;
+   mpz_t ez;
+
+   /* the field is not modified, so the image of f is set up here */
+   _nf_nmod_init(&mod, nf, m);
+   nf_nmod_precompute(&mod, nf);
+
+   if (mod.powers == NULL)
+   {
+      flint_printf("Exception (nf_elem_powmod_fmpz). Leading coefficient of\n");
+      flint_printf("defining polynomial not invertible modulo m.\n");
+      abort();
+   }
+
+   nmod_poly_init(pol, m);
+   mpz_init(ez);
+
+   nf_elem_get_nmod_poly(pol, a, nf);
+
+   fmpz_get_mpz(ez, e);
+   nmod_poly_powmod_mpz_binexp_preinv(pol, pol, ez, mod.pol, mod.pinv);
+
+   _nf_elem_set_ui_vec(res, pol->coeffs, pol->length, nf);
+
+   nmod_poly_clear(pol);
+   mpz_clear(ez);
+   _nf_nmod_clear(&mod);
+}
+
+static void
+_nf_elem_powmod_fmpz_mod(nf_elem_t res, const nf_elem_t a, const fmpz_t e,
+                                               const fmpz_t m, const nf_t nf)
+{
+   const slong len = nf->pol->length;
+   fmpz_mod_poly_t f, finv, pol;
+   fmpz_t g;
+   slong i;
+#if __FLINT_RELEASE >= 20700
+   fmpz_mod_ctx_t ctx;
+
+   fmpz_mod_ctx_init(ctx, m);
+
+   fmpz_mod_poly_init(f, ctx);
+   fmpz_mod_poly_init(finv, ctx);
+   fmpz_mod_poly_init(pol, ctx);
+#else
+   fmpz_mod_poly_init(f, m);
+   fmpz_mod_poly_init(finv, m);
+   fmpz_mod_poly_init(pol, m);
+#endif
+   fmpz_init(g);
+
+   FMPZ_MOD_POLY_FIT_LENGTH(f, len, ctx);
+   for (i = 0; i < len; i++)
+      FMPZ_MOD(f->coeffs + i, fmpq_poly_numref(nf->pol) + i, ctx, &(f->p));
+   _fmpz_mod_poly_set_length(f, len);
+   _fmpz_mod_poly_normalise(f);
+
+   if (f->length == len)
+      fmpz_gcd(g, f->coeffs + len - 1, m);
+
+   if (f->length != len || !fmpz_is_one(g))
+   {
+      flint_printf("Exception (nf_elem_powmod_fmpz). Leading coefficient of\n");
+      flint_printf("defining polynomial not invertible modulo m.\n");
+      abort();
+   }
+
+#if __FLINT_RELEASE >= 20700
+   fmpz_mod_poly_reverse(finv, f, len, ctx);
+   fmpz_mod_poly_inv_series_newton(finv, finv, len, ctx);
+
+   nf_elem_get_fmpz_mod_poly(pol, a, nf, ctx);
+
+   fmpz_mod_poly_powmod_fmpz_binexp_preinv(pol, pol, e, f, finv, ctx);
+#else
+   fmpz_mod_poly_reverse(finv, f, len);
+   fmpz_mod_poly_inv_series_newton(finv, finv, len);
+
+   nf_elem_get_fmpz_mod_poly(pol, a, nf);
+
+   fmpz_mod_poly_powmod_fmpz_binexp_preinv(pol, pol, e, f, finv);
+#endif
+
+   _nf_elem_set_fmpz_vec(res, pol->coeffs, pol->length, nf);
+
+#if __FLINT_RELEASE >= 20700
+   fmpz_mod_poly_clear(f, ctx);
+   fmpz_mod_poly_clear(finv, ctx);
+   fmpz_mod_poly_clear(pol, ctx);
+   fmpz_mod_ctx_clear(ctx);
+#else
+   fmpz_mod_poly_clear(f);
+   fmpz_mod_poly_clear(finv);
+   fmpz_mod_poly_clear(pol);
+#endif
+   fmpz_clear(g);
+}
+
+void nf_elem_powmod_fmpz(nf_elem_t res, const nf_elem_t a, const fmpz_t e,
+                                               const fmpz_t m, const nf_t nf)
+{
+   if (fmpz_sgn(e) < 0)
+   {
+      flint_printf("Exception (nf_elem_powmod_fmpz). Negative exponent.\n");
+      abort();
+   }
+
+   if (fmpz_sgn(m) <= 0)
+   {
+      flint_printf("Exception (nf_elem_powmod_fmpz). Nonpositive modulus.\n");
+      abort();
+   }
+
+   if (fmpz_is_one(m))
+   {
+      nf_elem_zero(res, nf);
+
+      return;
+   }
+
+   if (nf->flag & NF_LINEAR)
+   {
+      fmpz_t t;
+
+      fmpz_init(t);
+
+      if (!fmpz_invmod(t, LNF_ELEM_DENREF(a), m))
+      {
+         flint_printf("Exception (nf_elem_powmod_fmpz). Denominator not invertible.\n");
+         abort();
+      }
+
+      fmpz_mul(t, t, LNF_ELEM_NUMREF(a));
+      fmpz_mod(t, t, m);
+      fmpz_powm(LNF_ELEM_NUMREF(res), t, e, m);
+      fmpz_one(LNF_ELEM_DENREF(res));
+
+      fmpz_clear(t);
+   } else if (fmpz_abs_fits_ui(m))
+      _nf_elem_powmod_nmod(res, a, e, fmpz_get_ui(m), nf);
+   else
+      _nf_elem_powmod_fmpz_mod(res, a, e, m, nf);
+}
@@ -0,0 +1,140 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 10
+
+typedef struct
+{
+   slong length;
+   int modular;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_elem(nf_elem_t a, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+
+   random_fmpq_poly(NF_ELEM(a), state, len);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i;
+   int modular = info->modular;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol, P;
+   nf_t nf;
+   nf_elem_t a;
+
+   fmpq_poly_init(pol);
+   fmpq_poly_init(P);
+        
+   for (i = 0; i < count; i++)
+   {
+      do {
+         random_fmpq_poly(pol, state, length);
+      } while (pol->length != length);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+
+      do {
+         random_nf_elem(a, state, nf);
+      } while (nf_elem_is_rational(a, nf));
+	
+      prof_start();
+      if (modular)
+         _nf_elem_charpoly_modular(P, a, nf);
+      else
+         _nf_elem_charpoly_rep_mat(P, a, nf);
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+   fmpq_poly_clear(P);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Characteristic polynomial of number field elements\n");
+   flint_printf("bits = %ld\n", BITS);
+
+   for (k = 5; k <= 65; k = (slong) ceil(1.2*k))
+   {
+      info.length = k;
+      info.modular = 0;
+
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("rep_mat : degree %wd, min %.3e ms, max %.3e ms\n", 
+           info.length - 1,
+		   min/1000,
+           max/1000
+	     );
+
+      info.modular = 1;
+     
+      prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("modular : degree %wd, min %.3e ms, max %.3e ms\n", 
+           info.length - 1,
+		   min/1000,
+           max/1000
+	     );
+   }
+
+   return 0;
+}
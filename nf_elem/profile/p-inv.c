@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 100
+
+typedef struct
+{
+   slong length;
+   int modular;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_elem(nf_elem_t a, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+   slong i;
+
+   random_fmpq_poly(NF_ELEM(a), state, len);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j;
+   int modular = info->modular;
+   int scale;
+   
+   scale = 10;
+   if (length >= 30) scale = 1;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol, g, t;
+   nf_t nf;
+   nf_elem_t a, b;
+           
+   fmpq_poly_init(pol);
+   fmpq_poly_init(g);
+   fmpq_poly_init(t);
+        
+   for (i = 0; i < count; i++)
+   {
+      random_fmpq_poly(pol, state, length);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+      nf_elem_init(b, nf);
+        
+      do {
+         random_nf_elem(b, state, nf);
+      } while (nf_elem_is_zero(b, nf));
+	
+      prof_start();
+      for (j = 0; j < scale; j++)
+      {
+         if (modular)
+            _nf_elem_inv_modular(a, b, nf);
+         else
+            fmpq_poly_xgcd(g, NF_ELEM(a), t, NF_ELEM(b), nf->pol);
+      }
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+      nf_elem_clear(b, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+   fmpq_poly_clear(g);
+   fmpq_poly_clear(t);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k, scale;
+
+   printf("Number field element inversion\n");
+   flint_printf("bits = %ld\n", BITS);
+
+   for (k = 4; k <= 64; k = (slong) ceil(1.1*k))
+   {
+      info.length = k;
+      info.modular = 0;
+
+      scale = 10;
+      if (k >= 30) scale = 1;
+      
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("xgcd   : length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/scale),
+           (max/scale)
+	     );
+
+     info.modular = 1;
+     
+     prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("modular: length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/scale),
+           (max/scale)
+	     );
+   }
+
+   return 0;
+}
@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 100
+
+#define NUM 100
+
+typedef struct
+{
+   slong length;
+   int vec;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_elem(nf_elem_t a, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+   slong i;
+
+   random_fmpq_poly(NF_ELEM(a), state, len);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j;
+   int vec = info->vec;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_struct * a, * b, * c;
+
+   fmpq_poly_init(pol);
+
+   a = flint_malloc(NUM*sizeof(nf_elem_struct));
+   b = flint_malloc(NUM*sizeof(nf_elem_struct));
+   c = flint_malloc(NUM*sizeof(nf_elem_struct));
+        
+   for (i = 0; i < count; i++)
+   {
+      random_fmpq_poly(pol, state, length);
+	
+      nf_init(nf, pol);
+       
+      for (j = 0; j < NUM; j++)
+      {
+         nf_elem_init(a + j, nf);
+         nf_elem_init(b + j, nf);
+         nf_elem_init(c + j, nf);
+
+         random_nf_elem(b + j, state, nf);
+         random_nf_elem(c + j, state, nf);
+      }
+	
+      prof_start();
+      if (vec)
+         nf_elem_mul_vec(a, b, c, NUM, nf);
+      else
+      {
+         for (j = 0; j < NUM; j++)
+            nf_elem_mul(a + j, b + j, c + j, nf);
+      }
+	   prof_stop();
+
+      for (j = 0; j < NUM; j++)
+      {
+         nf_elem_clear(a + j, nf);
+         nf_elem_clear(b + j, nf);
+         nf_elem_clear(c + j, nf);
+      }
+        
+      nf_clear(nf);
+   }
+  
+   flint_free(a);
+   flint_free(b);
+   flint_free(c);
+
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Vector of number field element products\n");
+   flint_printf("bits = %ld, products = %ld\n", BITS, NUM);
+
+   for (k = 4; k <= 60; k = (slong) ceil(1.1*k))
+   {
+      info.length = k;
+      info.vec = 0;
+
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("mul    : length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+
+      info.vec = 1;
+     
+      prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("mul_vec: length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+   }
+
+   return 0;
+}
@@ -32,6 +32,7 @@ typedef struct
 {
    slong length;
    int monic;
+   int threads;
 } info_t;
 
 void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
@@ -72,6 +73,8 @@ void sample(void * arg, ulong count)
    if (length >= 50) scale = 10;
    if (length >= 500) scale = 4;
    
+   flint_set_num_threads(info->threads);
+
    flint_rand_t state;
    flint_randinit(state);
 
@@ -132,6 +135,7 @@ int main(void)
    {
       info.length = k;
       info.monic = 0;
+      info.threads = 1;
 
       scale = 100;
       if (k >= 50) scale = 10;
@@ -156,5 +160,30 @@ int main(void)
 	     );
    }
 
+   printf("Multimodular norm, large degree\n");
+
+   for (k = 17; k <= 65; k = (slong) ceil(1.1*k))
+   {
+      info.length = k;
+      info.monic = 0;
+
+      scale = 100;
+      if (k >= 50) scale = 10;
+      
+      for (info.threads = 1; info.threads <= 4; info.threads *= 2)
+      {
+         prof_repeat(&min, &max, sample, (void *) &info);
+      
+         flint_printf("threads %d: length %wd, min %.3e us, max %.3e us\n", 
+              info.threads,
+              info.length,
+		      (min/scale),
+              (max/scale)
+	        );
+      }
+   }
+
+   flint_cleanup_master();
+
    return 0;
 }
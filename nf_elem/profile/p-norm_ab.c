@@ -0,0 +1,154 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "fmpq.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 10
+
+#define ALEN 1000
+#define BLEN 10
+
+typedef struct
+{
+   slong length;
+   int method;
+} info_t;
+
+void random_fmpz_poly(fmpz_poly_t pol, flint_rand_t state, slong length)
+{
+   slong i;
+
+   fmpz_poly_fit_length(pol, length);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(pol->coeffs + i, state, BITS);
+
+   _fmpz_poly_set_length(pol, length);
+   _fmpz_poly_normalise(pol);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j, k;
+   int method = info->method;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpz_poly_t f;
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_t g, x;
+   fmpq * n;
+   unsigned char * logs;
+        
+   fmpz_poly_init(f);
+   fmpq_poly_init(pol);
+
+   n = flint_malloc(ALEN*BLEN*sizeof(fmpq));
+   for (j = 0; j < ALEN*BLEN; j++)
+      fmpq_init(n + j);
+   logs = flint_malloc(ALEN*BLEN);
+     
+   for (i = 0; i < count; i++)
+   {
+      do {
+         random_fmpz_poly(f, state, length);
+      } while (f->length != length);
+
+      fmpq_poly_set_fmpz_poly(pol, f);
+
+      nf_init(nf, pol);
+      nf_elem_init(g, nf);
+      nf_elem_init(x, nf);
+
+      nf_elem_gen(g, nf);
+	
+      prof_start();
+      if (method == 0)
+      {
+         for (j = 0; j < BLEN; j++)
+         {
+            for (k = 0; k < ALEN; k++)
+            {
+               nf_elem_scalar_mul_si(x, g, -(j + 1), nf);
+               nf_elem_add_si(x, x, k - ALEN/2, nf);
+               nf_elem_norm(n + j*ALEN + k, x, nf);
+            }
+         }
+      } else if (method == 1)
+         nf_elem_norm_ab(n, -ALEN/2, ALEN, 1, BLEN, nf);
+      else
+         nf_elem_norm_ab_log(logs, -ALEN/2, ALEN, 1, BLEN, nf);
+      prof_stop();
+
+      nf_elem_clear(g, nf);
+      nf_elem_clear(x, nf);
+      nf_clear(nf);
+   }
+  
+   for (j = 0; j < ALEN*BLEN; j++)
+      fmpq_clear(n + j);
+   flint_free(n);
+   flint_free(logs);
+
+   fmpz_poly_clear(f);
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Norms of a - b*theta over a rectangle\n");
+   flint_printf("bits = %ld, points = %ld\n", BITS, ALEN*BLEN);
+
+   for (k = 2; k <= 9; k++)
+   {
+      info.length = k;
+
+      info.method = 0;
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("norm       : length %wd, min %.3e us, max %.3e us\n", 
+           info.length, (min/(ALEN*BLEN)), (max/(ALEN*BLEN)));
+
+      info.method = 1;
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("norm_ab    : length %wd, min %.3e us, max %.3e us\n", 
+           info.length, (min/(ALEN*BLEN)), (max/(ALEN*BLEN)));
+
+      info.method = 2;
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("norm_ab_log: length %wd, min %.3e us, max %.3e us\n", 
+           info.length, (min/(ALEN*BLEN)), (max/(ALEN*BLEN)));
+   }
+
+   return 0;
+}
@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 10
+
+typedef struct
+{
+   ulong exp;
+   int unit;
+   int generic;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   ulong exp = info->exp;
+   int unit = info->unit, generic = info->generic;
+   slong i;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_t a, b;
+
+   fmpq_poly_init(pol);
+        
+   for (i = 0; i < count; i++)
+   {
+      /* x^2 - n*x - 1 has the unit x */
+      fmpq_poly_zero(pol);
+      fmpq_poly_set_coeff_si(pol, 2, unit ? 1 : n_randint(state, 1000) + 1);
+      fmpq_poly_set_coeff_si(pol, 1, -(slong) n_randint(state, 1000) - 1);
+      fmpq_poly_set_coeff_si(pol, 0, unit ? -1 : n_randint(state, 1000) + 1);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+      nf_elem_init(b, nf);
+
+      if (unit)
+         nf_elem_gen(a, nf);
+      else
+      {
+         fmpz_randbits(QNF_ELEM_NUMREF(a), state, BITS);
+         fmpz_randbits(QNF_ELEM_NUMREF(a) + 1, state, BITS);
+         fmpz_randbits(QNF_ELEM_DENREF(a), state, BITS);
+         fmpz_abs(QNF_ELEM_DENREF(a), QNF_ELEM_DENREF(a));
+         fmpz_add_ui(QNF_ELEM_DENREF(a), QNF_ELEM_DENREF(a), 1);
+         if (fmpz_is_zero(QNF_ELEM_NUMREF(a) + 1))
+            fmpz_one(QNF_ELEM_NUMREF(a) + 1);
+         nf_elem_canonicalise(a, nf);
+      }
+	
+      prof_start();
+      if (generic)
+         _nf_elem_pow(b, a, exp, nf);
+      else
+         nf_elem_pow(b, a, exp, nf);
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+      nf_elem_clear(b, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   ulong e;
+   int unit;
+
+   printf("Powering in quadratic fields\n");
+   flint_printf("bits = %ld\n", BITS);
+
+   for (unit = 0; unit <= 1; unit++)
+   {
+      for (e = 10; e <= 1000000; e *= 10)
+      {
+         info.exp = e;
+         info.unit = unit;
+
+         info.generic = 1;
+         prof_repeat(&min, &max, sample, (void *) &info);
+      
+         flint_printf("generic  : %s exp %wu, min %.3e ms, max %.3e ms\n", 
+              unit ? "unit   " : "general", e, (min/1000), (max/1000));
+
+         info.generic = 0;
+         prof_repeat(&min, &max, sample, (void *) &info);
+         
+         flint_printf("quadratic: %s exp %wu, min %.3e ms, max %.3e ms\n", 
+              unit ? "unit   " : "general", e, (min/1000), (max/1000));
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+typedef struct
+{
+   slong length;
+   slong bits;
+   int window;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, bits = info->bits, i;
+   int window = info->window;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_t a, b;
+   fmpz_t e;
+
+   fmpq_poly_init(pol);
+   fmpz_init(e);
+        
+   for (i = 0; i < count; i++)
+   {
+      /* x^n - x - 1 has the unit x */
+      fmpq_poly_zero(pol);
+      fmpq_poly_set_coeff_si(pol, length - 1, 1);
+      fmpq_poly_set_coeff_si(pol, 1, -1);
+      fmpq_poly_set_coeff_si(pol, 0, -1);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+      nf_elem_init(b, nf);
+
+      nf_elem_gen(a, nf);
+
+      fmpz_randbits(e, state, bits);
+      fmpz_abs(e, e);
+      fmpz_setbit(e, bits - 1);
+	
+      prof_start();
+      if (window)
+         nf_elem_pow_fmpz(b, a, e, nf);
+      else
+         nf_elem_pow(b, a, fmpz_get_ui(e), nf);
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+      nf_elem_clear(b, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+   fmpz_clear(e);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k, bits;
+
+   printf("Powering of units by large exponents\n");
+
+   for (k = 4; k <= 16; k *= 2)
+   {
+      for (bits = 4; bits <= 16; bits += 4)
+      {
+         info.length = k + 1;
+         info.bits = bits;
+
+         info.window = 0;
+         prof_repeat(&min, &max, sample, (void *) &info);
+      
+         flint_printf("binary : degree %wd, exp bits %wd, min %.3e ms, max %.3e ms\n", 
+              k, bits, (min/1000), (max/1000));
+
+         info.window = 1;
+         prof_repeat(&min, &max, sample, (void *) &info);
+         
+         flint_printf("window : degree %wd, exp bits %wd, min %.3e ms, max %.3e ms\n", 
+              k, bits, (min/1000), (max/1000));
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,127 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+typedef struct
+{
+   slong length;
+   ulong exp;
+   slong mbits;
+   int powmod;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, mbits = info->mbits, i, j;
+   ulong exp = info->exp;
+   int powmod = info->powmod;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_t a, b;
+   fmpz_t e, m;
+
+   fmpq_poly_init(pol);
+   fmpz_init_set_ui(e, exp);
+   fmpz_init(m);
+        
+   for (i = 0; i < count; i++)
+   {
+      fmpq_poly_zero(pol);
+      fmpq_poly_set_coeff_si(pol, length - 1, 1);
+      for (j = 0; j < length - 1; j++)
+         fmpq_poly_set_coeff_si(pol, j, n_randint(state, 200) - 100);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+      nf_elem_init(b, nf);
+
+      for (j = 0; j < length - 1; j++)
+         fmpq_poly_set_coeff_si(NF_ELEM(a), j, n_randint(state, 200) - 100);
+
+      fmpz_randbits(m, state, mbits);
+      fmpz_abs(m, m);
+      fmpz_setbit(m, mbits - 1);
+	
+      prof_start();
+      if (powmod)
+         nf_elem_powmod_fmpz(b, a, e, m, nf);
+      else
+      {
+         nf_elem_pow(b, a, exp, nf);
+         nf_elem_mod_fmpz(b, b, m, nf);
+      }
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+      nf_elem_clear(b, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+   fmpz_clear(e);
+   fmpz_clear(m);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k, mbits;
+   ulong exp;
+
+   printf("Modular powering of integral elements\n");
+
+   for (k = 4; k <= 16; k *= 2)
+   {
+      for (mbits = 60; mbits <= 240; mbits *= 4)
+      {
+         for (exp = 10; exp <= 10000; exp *= 10)
+         {
+            info.length = k + 1;
+            info.exp = exp;
+            info.mbits = mbits;
+
+            info.powmod = 0;
+            prof_repeat(&min, &max, sample, (void *) &info);
+      
+            flint_printf("pow/mod: degree %wd, modulus bits %wd, exp %wu, min %.3e ms, max %.3e ms\n", 
+                 k, mbits, exp, (min/1000), (max/1000));
+
+            info.powmod = 1;
+            prof_repeat(&min, &max, sample, (void *) &info);
+         
+            flint_printf("powmod : degree %wd, modulus bits %wd, exp %wu, min %.3e ms, max %.3e ms\n", 
+                 k, mbits, exp, (min/1000), (max/1000));
+         }
+      }
+   }
+
+   return 0;
+}
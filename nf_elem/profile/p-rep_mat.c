@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "fmpq_mat.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#define BITS 10
+
+#define NUM 20
+
+typedef struct
+{
+   slong length;
+   int canonicalise;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_elem(nf_elem_t a, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+
+   random_fmpq_poly(NF_ELEM(a), state, len);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, d = length - 1, i, j;
+   int canonicalise = info->canonicalise;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_t a;
+   fmpz_mat_t M;
+   fmpq_mat_t Q;
+   fmpz_t den;
+
+   fmpq_poly_init(pol);
+   fmpz_mat_init(M, d, d);
+   fmpq_mat_init(Q, d, d);
+   fmpz_init(den);
+        
+   for (i = 0; i < count; i++)
+   {
+      random_fmpq_poly(pol, state, length);
+	
+      nf_init(nf, pol);
+       
+      nf_elem_init(a, nf);
+
+      random_nf_elem(a, state, nf);
+	
+      prof_start();
+      for (j = 0; j < NUM; j++)
+      {
+         if (canonicalise == 2)
+            nf_elem_rep_mat(Q, a, nf);
+         else
+            _nf_elem_rep_mat_fmpz_mat_den(M, den, a, nf, canonicalise);
+      }
+	   prof_stop();
+
+      nf_elem_clear(a, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpz_mat_clear(M);
+   fmpq_mat_clear(Q);
+   fmpz_clear(den);
+
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Representation matrix of number field elements\n");
+   flint_printf("bits = %ld\n", BITS);
+
+   for (k = 4; k <= 100; k = (slong) ceil(1.1*k))
+   {
+      info.length = k;
+
+      for (info.canonicalise = 0; info.canonicalise <= 2; info.canonicalise++)
+      {
+         prof_repeat(&min, &max, sample, (void *) &info);
+      
+         flint_printf("%s: length %wd, min %.3e us, max %.3e us\n",
+              info.canonicalise == 0 ? "fmpz_mat (raw)" :
+              info.canonicalise == 1 ? "fmpz_mat      " : "fmpq_mat      ",
+              info.length,
+		      (min/NUM),
+              (max/NUM)
+	        );
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,94 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem.h"
+
+int _nf_elem_read_bin(nf_elem_t a, nf_bin_stream_t s,
+                                         const fmpz_t den, const nf_t nf)
+{
+   fmpz * anum, * aden;
+   ulong w;
+   slong i, alen, maxlen;
+
+   if (!_nf_bin_read_ui(&w, s))
+      return 0;
+
+   alen = w >> 1;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      anum = LNF_ELEM_NUMREF(a);
+      aden = LNF_ELEM_DENREF(a);
+      maxlen = 1;
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      anum = QNF_ELEM_NUMREF(a);
+      aden = QNF_ELEM_DENREF(a);
+      maxlen = 2;
+   } else
+   {
+      maxlen = fmpq_poly_degree(nf->pol);
+
+      if (alen <= maxlen)
+         fmpq_poly_fit_length(NF_ELEM(a), alen);
+
+      anum = NF_ELEM_NUMREF(a);
+      aden = NF_ELEM_DENREF(a);
+   }
+
+   if (alen > maxlen)
+   {
+      s->error = 1;
+      return 0;
+   }
+
+   if (w & 1)
+      fmpz_set(aden, den);
+   else
+      _nf_bin_read_fmpz(aden, s);
+
+   for (i = 0; i < alen; i++)
+      _nf_bin_read_fmpz(anum + i, s);
+
+   /* zero the unused coefficients of linear and quadratic elements */
+   if (nf->flag & NF_LINEAR)
+   {
+      if (alen == 0)
+         fmpz_zero(anum);
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      for (i = alen; i < 3; i++)
+         fmpz_zero(anum + i);
+   } else
+      _fmpq_poly_set_length(NF_ELEM(a), alen);
+
+   /* reject non-canonical elements as nf_read_bin does for the modulus */
+   if (s->error || !_fmpq_poly_is_canonical(anum, aden, alen))
+   {
+      nf_elem_zero(a, nf);
+      s->error = 1;
+      return 0;
+   }
+
+   return 1;
+}
+
+int nf_elem_read_bin(nf_elem_t a, nf_bin_stream_t s, const nf_t nf)
+{
+   fmpz_t one;
+   int res;
+
+   fmpz_init_set_ui(one, 1);
+   res = _nf_elem_read_bin(a, s, one, nf);
+   fmpz_clear(one);
+
+   return res;
+}
@@ -56,7 +56,7 @@ void _nf_elem_reduce(nf_elem_t a, const nf_t nf)
       {
          if (nf->flag & NF_MONIC)
          {
-            if (len <= NF_POWERS_CUTOFF)
+            if (_nf_use_powers(nf))
             {
                _fmpz_poly_rem_powers_precomp(NF_ELEM_NUMREF(a), plen,
                   fmpq_poly_numref(nf->pol), len, nf->powers.zz->powers);
@@ -86,7 +86,7 @@ void _nf_elem_reduce(nf_elem_t a, const nf_t nf)
          {
             fmpq_poly_t t;
         
-            if (len <= NF_POWERS_CUTOFF)
+            if (_nf_use_powers(nf))
             {
                _fmpq_poly_rem_powers_precomp(NF_ELEM_NUMREF(a), 
                   fmpq_poly_denref(NF_ELEM(a)), plen,
@@ -101,7 +101,7 @@ void _nf_elem_reduce(nf_elem_t a, const nf_t nf)
 
                _fmpq_poly_rem(t->coeffs, t->den,
                   NF_ELEM(a)->coeffs, NF_ELEM(a)->den, plen, 
-                  nf->pol->coeffs, nf->pol->den, len, nf->pinv.qq); 
+                  nf->pol->coeffs, nf->pol->den, len, _nf_pinv(nf)); 
            
                _fmpq_poly_set_length(t, len - 1);
                _fmpq_poly_normalise(t);
@@ -14,180 +14,129 @@
 
 ******************************************************************************/
 
+#include "flint/fmpz_vec.h"
 #include "nf_elem.h"
 
-void nf_elem_rep_mat_fmpz_mat_den(fmpz_mat_t res, fmpz_t den, const nf_elem_t a, const nf_t nf)
+/*
+   Row j of the matrix is x^j*a mod f. Write c for the leading coefficient
+   of num(f). The reduction of x^j*a introduces at most alen - 1 divisions
+   by c, so scaling a by |c|^(alen - 1) up front makes every row integral
+   with the common denominator den(a)*|c|^(alen - 1). Each row is then
+   obtained from the previous one by a shift followed by the subtraction of
+   (t/c)*num(f), where t is the top coefficient shifted out. The division
+   is exact by the choice of scaling.
+*/
+static void
+_nf_elem_rep_mat_companion(fmpz_mat_t res, fmpz_t den, const fmpz * anum,
+        const fmpz_t aden, slong alen, const nf_t nf, int canonicalise)
 {
-    if (nf->flag & NF_LINEAR)
+    const slong d = fmpq_poly_degree(nf->pol);
+    const fmpz * const fnum = fmpq_poly_numref(nf->pol);
+    const fmpz * const c = fnum + d;
+    fmpz * row, * prev;
+    fmpz_t s, q;
+    slong i, j;
+
+    if (alen == 0)
     {
-        fmpz_set(fmpz_mat_entry(res, 0, 0), LNF_ELEM_NUMREF(a));
-        fmpz_set(den, LNF_ELEM_DENREF(a));
+        fmpz_mat_zero(res);
+        fmpz_one(den);
+        return;
     }
-    else if (nf->flag & NF_QUADRATIC)
-    {
-        nf_elem_t t;
-        const fmpz * const anum = QNF_ELEM_NUMREF(a);
-        const fmpz * const aden = QNF_ELEM_DENREF(a);
-        fmpz * const tnum = QNF_ELEM_NUMREF(t);
-        fmpz * const tden = QNF_ELEM_DENREF(t);
 
-        nf_elem_init(t, nf);
-        nf_elem_mul_gen(t, a, nf);
+    fmpz_init(s);
+    fmpz_init(q);
 
-        if (fmpz_equal(tden, aden))
-        {
-            fmpz_set(fmpz_mat_entry(res, 0, 0), anum);
-            fmpz_set(fmpz_mat_entry(res, 0, 1), anum + 1);
-            fmpz_set(fmpz_mat_entry(res, 1, 0), tnum);
-            fmpz_set(fmpz_mat_entry(res, 1, 1), tnum + 1);
+    row = res->rows[0];
 
-            fmpz_set(den, tden);
-        }
-        else
-        {
-            fmpz_lcm(den, tden, aden);
-            fmpz_divexact(fmpz_mat_entry(res, 0, 0), den, aden);
-            fmpz_mul(fmpz_mat_entry(res, 0, 1), anum + 1, fmpz_mat_entry(res, 0, 0));
-            fmpz_mul(fmpz_mat_entry(res, 0, 0), anum, fmpz_mat_entry(res, 0, 0));
-
-            fmpz_divexact(fmpz_mat_entry(res, 1, 0), den, tden);
-            fmpz_mul(fmpz_mat_entry(res, 1, 1), tnum + 1, fmpz_mat_entry(res, 1, 0));
-            fmpz_mul(fmpz_mat_entry(res, 1, 0), tnum, fmpz_mat_entry(res, 1, 0));
-        }
-        nf_elem_clear(t, nf);
+    if (alen > 1 && !fmpz_is_pm1(c))
+    {
+        fmpz_abs(s, c);
+        fmpz_pow_ui(s, s, alen - 1);
+        _fmpz_vec_scalar_mul_fmpz(row, anum, alen, s);
+        fmpz_mul(den, aden, s);
+    } else
+    {
+        _fmpz_vec_set(row, anum, alen);
+        fmpz_set(den, aden);
     }
-    else
+
+    _fmpz_vec_zero(row + alen, d - alen);
+
+    for (j = 1; j < d; j++)
     {
-        slong i, j;
-        nf_elem_t t;
-        slong d = fmpq_poly_degree(nf->pol);
+        prev = res->rows[j - 1];
+        row = res->rows[j];
 
-        nf_elem_init(t, nf);
-        nf_elem_set(t, a, nf);
+        fmpz_zero(row);
+        for (i = 1; i < d; i++)
+            fmpz_set(row + i, prev + i - 1);
 
-        if (NF_ELEM(a)->length == 0)
+        if (!fmpz_is_zero(prev + d - 1))
         {
-            fmpz_mat_zero(res);
-            fmpz_one(den);
+            if (fmpz_is_one(c))
+                fmpz_set(q, prev + d - 1);
+            else if (fmpz_equal_si(c, -1))
+                fmpz_neg(q, prev + d - 1);
+            else
+                fmpz_divexact(q, prev + d - 1, c);
+
+            _fmpz_vec_scalar_submul_fmpz(row, fnum, d, q);
         }
-        else if (NF_ELEM(a)->length == 1)
+    }
+
+    /* the rows share their denominator, so one content computation suffices */
+    if (canonicalise && !fmpz_is_one(den))
+    {
+        fmpz_set(s, den);
+
+        for (j = 0; j < d && !fmpz_is_one(s); j++)
         {
-            fmpz_mat_zero(res);
-            for (i = 0; i <= d - 1; i++)
-            {
-              fmpz_set(fmpz_mat_entry(res, i, i), fmpq_poly_numref(NF_ELEM(a)));
-            }
-            fmpz_set(den, fmpq_poly_denref(NF_ELEM(a)));
+            _fmpz_vec_content(q, res->rows[j], d);
+            fmpz_gcd(s, s, q);
         }
-        else
+
+        if (!fmpz_is_one(s))
         {
-            /* Special case if defining polynomial is monic and integral and the element also has trivial denominator */
-            if (nf->flag & NF_MONIC && fmpz_is_one(fmpq_poly_denref(nf->pol)) && fmpz_is_one(fmpq_poly_denref(NF_ELEM(a))))
-            {
-                fmpz_one(den);
-
-                for (i = 0; i <= NF_ELEM(a)->length - 1; i++)
-                    fmpz_set(fmpz_mat_entry(res, 0, i), fmpq_poly_numref(NF_ELEM(a)) + i);
-
-                for (i = NF_ELEM(a)->length; i <= d - 1; i++)
-                    fmpz_zero(fmpz_mat_entry(res, 0, i));
-
-                for (j = 1; j <= d - NF_ELEM(a)->length; j++)
-                {
-                    nf_elem_mul_gen(t, t, nf);
-                    for (i = 0; i < j; i++)
-                        fmpz_zero(fmpz_mat_entry(res, j, i));
-
-                    for (i = 0; i <= NF_ELEM(a)->length - 1; i++)
-                        fmpz_set(fmpz_mat_entry(res, j, j + i), fmpq_poly_numref(NF_ELEM(a)) + i);
-
-                    for (i = j + NF_ELEM(a)->length; i <= d - 1; i++)
-                        fmpz_zero(fmpz_mat_entry(res, j, i));
-                }
-
-                for (j = d - NF_ELEM(a)->length + 1; j <= d - 1; j++)
-                {
-                    nf_elem_mul_gen(t, t, nf);
-                    for (i = 0; i <= d - 1; i++)
-                        fmpz_set(fmpz_mat_entry(res, j, i), fmpq_poly_numref(NF_ELEM(t)) + i);
-                }
-            }
-            else
-            {
-                /* Now the general case. For 0 <= j < d - 2 we store the
-                 * denominator for row j at res[d - 1, j]. At the end we
-                 * divide the lcm of all of them by the corresponding
-                 * denominator of the row to get the correct multiplier for
-                 * row.
-                 */
-
-                for (i = 0; i <= NF_ELEM(a)->length - 1; i++)
-                    fmpz_set(fmpz_mat_entry(res, 0, i), fmpq_poly_numref(NF_ELEM(a)) + i);
-
-                for (i = NF_ELEM(a)->length; i <= d - 1; i++)
-                    fmpz_zero(fmpz_mat_entry(res, 0, i));
-
-                fmpz_set(fmpz_mat_entry(res, d - 1, 0), fmpq_poly_denref(NF_ELEM(a)));
-
-                for (j = 1; j <= d - NF_ELEM(a)->length; j++)
-                {
-                    nf_elem_mul_gen(t, t, nf);
-                    for (i = 0; i < j; i++)
-                        fmpz_zero(fmpz_mat_entry(res, j, i));
-
-                    for (i = 0; i <= NF_ELEM(a)->length - 1; i++)
-                        fmpz_set(fmpz_mat_entry(res, j, j + i), fmpq_poly_numref(NF_ELEM(a)) + i);
-
-                    for (i = j + NF_ELEM(a)->length; i <= d - 1; i++)
-                        fmpz_zero(fmpz_mat_entry(res, j, i));
-
-                    fmpz_set(fmpz_mat_entry(res, d - 1, j), fmpq_poly_denref(NF_ELEM(a)));
-                }
-
-                for (j = d - NF_ELEM(a)->length + 1; j <= d - 2; j++)
-                {
-                    nf_elem_mul_gen(t, t, nf);
-                    for (i = 0; i <= d - 1; i++)
-                        fmpz_set(fmpz_mat_entry(res, j, i), fmpq_poly_numref(NF_ELEM(t)) + i);
-
-                    fmpz_set(fmpz_mat_entry(res, d - 1, j), fmpq_poly_denref(NF_ELEM(t)));
-
-                }
-
-                nf_elem_mul_gen(t, t, nf);
-                /* Now compute the correct denominator */
-
-                fmpz_set(fmpz_mat_entry(res, d - 1, d - 1), fmpq_poly_denref(NF_ELEM(t)));
-
-                fmpz_set(den, fmpq_poly_denref(NF_ELEM(t)));
-
-                for (j = 0; j <= d - 2; j++)
-                    fmpz_lcm(den, den, fmpz_mat_entry(res, d - 1, j));
-
-                for (j = 0; j <= d - 2; j++)
-                {
-                    if (!fmpz_equal(den, fmpz_mat_entry(res, d - 1, j)))
-                    {
-                        fmpz_divexact(fmpz_mat_entry(res, d - 1, j), den, fmpz_mat_entry(res, d - 1, j));
-
-                        for (i = 0; i <= d - 1; i++)
-                            fmpz_mul(fmpz_mat_entry(res, j, i), fmpz_mat_entry(res, j, i), fmpz_mat_entry(res, d - 1, j));
-                    }
-                }
-
-                if (fmpz_equal(den, fmpz_mat_entry(res, d - 1, d - 1)))
-                {
-                    for (i = 0; i < d; i++)
-                        fmpz_set(fmpz_mat_entry(res, d - 1, i), fmpq_poly_numref(NF_ELEM(t)) + i);
-                }
-                else
-                {
-                    fmpz_divexact(fmpz_mat_entry(res, d - 1, d - 1), den, fmpq_poly_denref(NF_ELEM(t)));
-                    for (i = 0; i < d; i++)
-                        fmpz_mul(fmpz_mat_entry(res, d - 1, i), fmpq_poly_numref(NF_ELEM(t)) + i, fmpz_mat_entry(res, d - 1, d - 1));
-                }
-            }
+            for (j = 0; j < d; j++)
+                _fmpz_vec_scalar_divexact_fmpz(res->rows[j],
+                                                     res->rows[j], d, s);
+
+            fmpz_divexact(den, den, s);
         }
-        nf_elem_clear(t, nf);
     }
+
+    fmpz_clear(s);
+    fmpz_clear(q);
+}
+
+void _nf_elem_rep_mat_fmpz_mat_den(fmpz_mat_t res, fmpz_t den,
+                        const nf_elem_t a, const nf_t nf, int canonicalise)
+{
+    if (nf->flag & NF_LINEAR)
+    {
+        fmpz_set(fmpz_mat_entry(res, 0, 0), LNF_ELEM_NUMREF(a));
+        fmpz_set(den, LNF_ELEM_DENREF(a));
+    }
+    else if (nf->flag & NF_QUADRATIC)
+    {
+        const fmpz * const anum = QNF_ELEM_NUMREF(a);
+        slong alen = 2;
+
+        while (alen > 0 && fmpz_is_zero(anum + alen - 1))
+            alen--;
+
+        _nf_elem_rep_mat_companion(res, den, anum, QNF_ELEM_DENREF(a),
+                                                   alen, nf, canonicalise);
+    }
+    else
+    {
+        _nf_elem_rep_mat_companion(res, den, NF_ELEM_NUMREF(a),
+                    NF_ELEM_DENREF(a), NF_ELEM(a)->length, nf, canonicalise);
+    }
+}
+
+void nf_elem_rep_mat_fmpz_mat_den(fmpz_mat_t res, fmpz_t den, const nf_elem_t a, const nf_t nf)
+{
+    _nf_elem_rep_mat_fmpz_mat_den(res, den, a, nf, 1);
 }
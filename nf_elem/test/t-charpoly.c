@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+/* set r = P(a) */
+void
+evaluate(nf_elem_t r, const fmpq_poly_t P, const nf_elem_t a, const nf_t nf)
+{
+    fmpq_t c;
+    slong i;
+
+    fmpq_init(c);
+
+    nf_elem_zero(r, nf);
+
+    for (i = P->length - 1; i >= 0; i--)
+    {
+        nf_elem_mul(r, r, a, nf);
+        fmpq_poly_get_coeff_fmpq(c, P, i);
+        nf_elem_add_fmpq(r, r, c, nf);
+    }
+
+    fmpq_clear(c);
+}
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("charpoly....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test P(a) = 0, P is monic of degree d and P(0) = (-1)^d N(a) */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, r;
+        fmpq_poly_t P;
+        fmpq_t n, c;
+        slong d;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        d = fmpq_poly_degree(nf->pol);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(r, nf);
+        fmpq_poly_init(P);
+        fmpq_init(n);
+        fmpq_init(c);
+
+        nf_elem_randtest(a, state, 100, nf);
+
+        nf_elem_charpoly(P, a, nf);
+
+        evaluate(r, P, a, nf);
+
+        nf_elem_norm(n, a, nf);
+        if (d % 2 == 1)
+            fmpq_neg(n, n);
+        fmpq_poly_get_coeff_fmpq(c, P, 0);
+
+        result = (fmpq_poly_degree(P) == d && fmpq_poly_is_monic(P)
+                                     && fmpq_equal(c, n));
+
+        /* the Cayley-Hamilton theorem */
+        result = result && nf_elem_is_zero(r, nf);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+            printf("P = "); fmpq_poly_print_pretty(P, "x"); printf("\n");
+            printf("n = "); fmpq_print(n); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(r, nf);
+        fmpq_poly_clear(P);
+        fmpq_clear(n);
+        fmpq_clear(c);
+
+        nf_clear(nf);
+    }
+
+    /* compare the multimodular and representation matrix algorithms */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+        fmpq_poly_t P1, P2;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        do {
+           nf_init_randtest(nf, state, 20, 50);
+           if (nf->pol->length > 3)
+              break;
+           nf_clear(nf);
+        } while (1);
+
+        nf_elem_init(a, nf);
+        fmpq_poly_init(P1);
+        fmpq_poly_init(P2);
+
+        do {
+           nf_elem_randtest(a, state, 1 + n_randint(state, 100), nf);
+        } while (nf_elem_is_rational(a, nf));
+
+        _nf_elem_charpoly_modular(P1, a, nf);
+        _nf_elem_charpoly_rep_mat(P2, a, nf);
+
+        result = fmpq_poly_equal(P1, P2);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+            printf("P1 = "); fmpq_poly_print_pretty(P1, "x"); printf("\n");
+            printf("P2 = "); fmpq_poly_print_pretty(P2, "x"); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+        fmpq_poly_clear(P1);
+        fmpq_poly_clear(P2);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
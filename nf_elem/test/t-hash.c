@@ -0,0 +1,139 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpz_vec.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+/* multiply numerator and denominator of a by c without canonicalising */
+void
+scale_raw(nf_elem_t a, const fmpz_t c, const nf_t nf)
+{
+    if (nf->flag & NF_LINEAR)
+    {
+        fmpz_mul(LNF_ELEM_NUMREF(a), LNF_ELEM_NUMREF(a), c);
+        fmpz_mul(LNF_ELEM_DENREF(a), LNF_ELEM_DENREF(a), c);
+    } else if (nf->flag & NF_QUADRATIC)
+    {
+        _fmpz_vec_scalar_mul_fmpz(QNF_ELEM_NUMREF(a), QNF_ELEM_NUMREF(a), 3, c);
+        fmpz_mul(QNF_ELEM_DENREF(a), QNF_ELEM_DENREF(a), c);
+    } else
+    {
+        _fmpz_vec_scalar_mul_fmpz(NF_ELEM_NUMREF(a), NF_ELEM_NUMREF(a),
+                                                    NF_ELEM(a)->length, c);
+        fmpz_mul(NF_ELEM_DENREF(a), NF_ELEM_DENREF(a), c);
+    }
+}
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("hash....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test the fingerprint only depends on the value */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, b, c;
+        fmpz_t s;
+        ulong h1, h2, h3;
+        int r1, r2;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+        nf_elem_init(c, nf);
+        fmpz_init(s);
+
+        nf_elem_randtest(a, state, 100, nf);
+        nf_elem_set(b, a, nf);
+
+        fmpz_randtest_not_zero(s, state, 100);
+        fmpz_abs(s, s);
+        scale_raw(b, s, nf);
+
+        r1 = _nf_elem_hash(&h1, a, nf);
+        r2 = _nf_elem_hash(&h2, b, nf);
+
+        result = _nf_elem_equal(a, b, nf) && r1 && r2 && h1 == h2
+                                       && h1 == nf_elem_hash(a, nf);
+
+        /* a + 1 differs from a, and so does its fingerprint */
+        nf_elem_add_si(c, a, 1, nf);
+        h3 = nf_elem_hash(c, nf);
+
+        result = result && !_nf_elem_equal(c, b, nf) && h3 != h1;
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+            printf("s = "); fmpz_print(s); printf("\n");
+            flint_printf("r1 = %d, r2 = %d\n", r1, r2);
+            flint_printf("h1 = %wu, h2 = %wu, h3 = %wu\n", h1, h2, h3);
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+        nf_elem_clear(c, nf);
+        fmpz_clear(s);
+
+        nf_clear(nf);
+    }
+
+    /* test the fingerprint is fixed for a given element */
+    for (i = 0; i < 10 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+
+        do {
+           nf_init_randtest(nf, state, 20, 100);
+           if (nf->pol->length > 3)
+              break;
+           nf_clear(nf);
+        } while (1);
+
+        nf_elem_init(a, nf);
+
+        nf_elem_gen(a, nf);
+        result = (nf_elem_hash(a, nf) == NF_ELEM_HASH_POINT);
+
+        nf_elem_set_si(a, -1, nf);
+        result = result && (nf_elem_hash(a, nf) == NF_ELEM_HASH_PRIME - 1);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("inv_modular....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test multimodular inverse agrees with xgcd over Q */
+    for (i = 0; i < 10 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, b;
+        fmpq_poly_t g, t, c;
+
+        do {
+           nf_init_randtest(nf, state, 25, 200);
+           if (nf->flag & (NF_LINEAR | NF_QUADRATIC))
+              nf_clear(nf);
+           else
+              break;
+        } while (1);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+
+        fmpq_poly_init(g);
+        fmpq_poly_init(t);
+        fmpq_poly_init(c);
+
+        do {
+           nf_elem_randtest_not_zero(b, state, 200, nf);
+        } while (!_nf_elem_invertible_check(b, nf));
+
+        result = _nf_elem_inv_modular(a, b, nf);
+
+        fmpq_poly_xgcd(g, c, t, NF_ELEM(b), nf->pol);
+
+        result = result && fmpq_poly_equal(NF_ELEM(a), c);
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("nf->pol = "); fmpq_poly_print_pretty(nf->pol, "x"); printf("\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+           printf("c = "); fmpq_poly_print_pretty(c, "x"); printf("\n");
+           abort();
+        }
+
+        fmpq_poly_clear(g);
+        fmpq_poly_clear(t);
+        fmpq_poly_clear(c);
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpz_poly_factor.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("minpoly....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test the minimal polynomial of a is g for a = x^2 in Q[x]/g(x^2) */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+        fmpq_poly_t f, g, P;
+        fmpz_poly_factor_t fac;
+        fmpz_poly_t h;
+
+        fmpq_poly_init(f);
+        fmpq_poly_init(g);
+        fmpq_poly_init(P);
+        fmpz_poly_init(h);
+
+        /* find g of degree at least 2 with g(x^2) irreducible */
+        do {
+            fmpq_poly_randtest_not_zero(g, state, 3 + n_randint(state, 6), 20);
+            if (g->length < 3)
+                continue;
+
+            fmpq_poly_zero(f);
+            fmpq_poly_set_coeff_ui(f, 2, 1);
+            fmpq_poly_compose(f, g, f);
+
+            fmpq_poly_get_numerator(h, f);
+            fmpz_poly_factor_init(fac);
+            fmpz_poly_factor(fac, h);
+            result = (fac->num == 1 && fac->exp[0] == 1);
+            fmpz_poly_factor_clear(fac);
+        } while (g->length < 3 || !result);
+
+        nf_init(nf, f);
+        nf_elem_init(a, nf);
+
+        nf_elem_gen(a, nf);
+        nf_elem_mul(a, a, a, nf);
+
+        nf_elem_minpoly(P, a, nf);
+
+        fmpq_poly_make_monic(g, g);
+
+        result = fmpq_poly_equal(P, g);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("P = "); fmpq_poly_print_pretty(P, "x"); printf("\n");
+            printf("g = "); fmpq_poly_print_pretty(g, "x"); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_clear(nf);
+
+        fmpq_poly_clear(f);
+        fmpq_poly_clear(g);
+        fmpq_poly_clear(P);
+        fmpz_poly_clear(h);
+    }
+
+    /* test the minimal polynomial divides the characteristic polynomial */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+        fmpq_poly_t P, Q, R;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        nf_elem_init(a, nf);
+        fmpq_poly_init(P);
+        fmpq_poly_init(Q);
+        fmpq_poly_init(R);
+
+        nf_elem_randtest(a, state, 100, nf);
+
+        nf_elem_minpoly(P, a, nf);
+        nf_elem_charpoly(Q, a, nf);
+
+        fmpq_poly_rem(R, Q, P);
+
+        result = (fmpq_poly_is_monic(P) && fmpq_poly_is_zero(R));
+        result = result && (!nf_elem_is_rational(a, nf) || P->length == 2);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+            printf("P = "); fmpq_poly_print_pretty(P, "x"); printf("\n");
+            printf("Q = "); fmpq_poly_print_pretty(Q, "x"); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(a, nf);
+        fmpq_poly_clear(P);
+        fmpq_poly_clear(Q);
+        fmpq_poly_clear(R);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against nf_elem_mul */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b, * c;
+        nf_elem_t p;
+        slong j, n;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        n = n_randint(state, 10);
+
+        a = flint_malloc(n*sizeof(nf_elem_struct));
+        b = flint_malloc(n*sizeof(nf_elem_struct));
+        c = flint_malloc(n*sizeof(nf_elem_struct));
+
+        nf_elem_init(p, nf);
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_init(a + j, nf);
+            nf_elem_init(b + j, nf);
+            nf_elem_init(c + j, nf);
+
+            nf_elem_randtest(a + j, state, 200, nf);
+            nf_elem_randtest(b + j, state, 200, nf);
+            nf_elem_randtest(c + j, state, 200, nf);
+        }
+
+        nf_elem_mul_vec(a, b, c, n, nf);
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_mul(p, b + j, c + j, nf);
+
+            result = (nf_elem_equal(p, a + j, nf));
+            if (!result)
+            {
+               printf("FAIL:\n");
+               flint_printf("n = %wd, j = %wd\n", n, j);
+               printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+               printf("b = "); nf_elem_print_pretty(b + j, nf, "x"); printf("\n");
+               printf("c = "); nf_elem_print_pretty(c + j, nf, "x"); printf("\n");
+               printf("p = "); nf_elem_print_pretty(p, nf, "x"); printf("\n");
+               abort();
+            }
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_clear(a + j, nf);
+            nf_elem_clear(b + j, nf);
+            nf_elem_clear(c + j, nf);
+        }
+
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+
+        nf_elem_clear(p, nf);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing a and b */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b, * c;
+        slong j, n;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        n = n_randint(state, 10);
+
+        a = flint_malloc(n*sizeof(nf_elem_struct));
+        b = flint_malloc(n*sizeof(nf_elem_struct));
+        c = flint_malloc(n*sizeof(nf_elem_struct));
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_init(a + j, nf);
+            nf_elem_init(b + j, nf);
+            nf_elem_init(c + j, nf);
+
+            nf_elem_randtest(b + j, state, 200, nf);
+            nf_elem_randtest(c + j, state, 200, nf);
+        }
+
+        nf_elem_mul_vec(a, b, c, n, nf);
+        nf_elem_mul_vec(b, b, c, n, nf);
+
+        for (j = 0; j < n; j++)
+        {
+            result = (nf_elem_equal(a + j, b + j, nf));
+            if (!result)
+            {
+               printf("FAIL:\n");
+               flint_printf("n = %wd, j = %wd\n", n, j);
+               printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+               printf("b = "); nf_elem_print_pretty(b + j, nf, "x"); printf("\n");
+               printf("c = "); nf_elem_print_pretty(c + j, nf, "x"); printf("\n");
+               abort();
+            }
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_clear(a + j, nf);
+            nf_elem_clear(b + j, nf);
+            nf_elem_clear(c + j, nf);
+        }
+
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+         
+        nf_clear(nf);
+    }
+
+    /* test aliasing a, b and c */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        slong j, n;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        n = n_randint(state, 10);
+
+        a = flint_malloc(n*sizeof(nf_elem_struct));
+        b = flint_malloc(n*sizeof(nf_elem_struct));
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_init(a + j, nf);
+            nf_elem_init(b + j, nf);
+
+            nf_elem_randtest(b + j, state, 200, nf);
+            nf_elem_mul(a + j, b + j, b + j, nf);
+        }
+
+        nf_elem_mul_vec(b, b, b, n, nf);
+
+        for (j = 0; j < n; j++)
+        {
+            result = (nf_elem_equal(a + j, b + j, nf));
+            if (!result)
+            {
+               printf("FAIL:\n");
+               flint_printf("n = %wd, j = %wd\n", n, j);
+               printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+               printf("b = "); nf_elem_print_pretty(b + j, nf, "x"); printf("\n");
+               abort();
+            }
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            nf_elem_clear(a + j, nf);
+            nf_elem_clear(b + j, nf);
+        }
+
+        flint_free(a);
+        flint_free(b);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("norm_ab....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with nf_elem_norm of a - b*theta */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t g, x;
+        fmpq * n;
+        unsigned char * logs;
+        fmpq_t n2;
+        slong a0, b0, alen, blen, j, k, bits, nbits;
+
+        nf_init_randtest(nf, state, 9, 1 + n_randint(state, 30));
+
+        /* exercise the word, double word and multiprecision paths */
+        bits = 1 + n_randint(state, 40);
+        a0 = z_randtest(state) % (WORD(1) << bits);
+        b0 = z_randtest(state) % (WORD(1) << bits);
+        alen = n_randint(state, 20);
+        blen = n_randint(state, 5);
+
+        nf_elem_init(g, nf);
+        nf_elem_init(x, nf);
+        fmpq_init(n2);
+
+        n = (fmpq *) flint_malloc(alen*blen*sizeof(fmpq));
+        logs = (unsigned char *) flint_malloc(alen*blen);
+        for (j = 0; j < alen*blen; j++)
+           fmpq_init(n + j);
+
+        nf_elem_norm_ab(n, a0, alen, b0, blen, nf);
+        nf_elem_norm_ab_log(logs, a0, alen, b0, blen, nf);
+
+        nf_elem_gen(g, nf);
+
+        result = 1;
+        for (j = 0; j < blen && result; j++)
+        {
+           for (k = 0; k < alen && result; k++)
+           {
+              nf_elem_scalar_mul_si(x, g, -(b0 + j), nf);
+              nf_elem_add_si(x, x, a0 + k, nf);
+              nf_elem_norm(n2, x, nf);
+
+              result = fmpq_equal(n + j*alen + k, n2);
+
+              /* the log is within a few bits of the true value */
+              nbits = fmpz_bits(fmpq_numref(n2)) - fmpz_bits(fmpq_denref(n2));
+              nbits = FLINT_MIN(FLINT_MAX(nbits, 0), 255);
+              result = result && (fmpq_is_zero(n2) ? logs[j*alen + k] == 0 :
+                         FLINT_ABS(nbits - logs[j*alen + k]) <= 2);
+           }
+        }
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           nf_print(nf); printf("\n");
+           flint_printf("a = %wd, b = %wd\n", a0 + k - 1, b0 + j - 1);
+           printf("n = "); fmpq_print(n + (j - 1)*alen + k - 1); printf("\n");
+           printf("n2 = "); fmpq_print(n2); printf("\n");
+           flint_printf("log = %d\n", (int) logs[(j - 1)*alen + k - 1]);
+           abort();
+        }
+
+        for (j = 0; j < alen*blen; j++)
+           fmpq_clear(n + j);
+        flint_free(n);
+        flint_free(logs);
+
+        nf_elem_clear(g, nf);
+        nf_elem_clear(x, nf);
+        fmpq_clear(n2);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "flint/fmpz_factor.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("norm_is_smooth....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with trial division of Res(f, num(a))/divisor */
+    for (i = 0; i < 200 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+        fmpz_factor_t fac;
+        mp_limb_t primes[100];
+        fmpq_t n;
+        fmpq_poly_t g;
+        fmpz_t Q, D, t, pz;
+        const fmpz * lead;
+        slong j, num_primes, nbits;
+        int smooth, smooth2, use_divisor;
+
+        nf_init_randtest(nf, state, 6, 1 + n_randint(state, 4));
+        lead = fmpq_poly_numref(nf->pol) + nf->pol->length - 1;
+
+        nf_elem_init(a, nf);
+        fmpz_factor_init(fac);
+        fmpq_init(n);
+        fmpq_poly_init(g);
+        fmpz_init(Q);
+        fmpz_init(D);
+        fmpz_init(t);
+        fmpz_init(pz);
+
+        num_primes = 1 + n_randint(state, 100);
+        primes[0] = 2;
+        for (j = 1; j < num_primes; j++)
+           primes[j] = n_nextprime(primes[j - 1], 0);
+
+        do {
+           nf_elem_randtest(a, state, 1 + n_randint(state, 6), nf);
+        } while (nf_elem_is_zero(a, nf));
+
+        /* Q = N(a) lead(f)^deg(a) den(a)^deg(f) */
+        nf_elem_norm(n, a, nf);
+        nf_elem_get_fmpq_poly(g, a, nf);
+        fmpz_pow_ui(t, lead, g->length - 1);
+        fmpq_mul_fmpz(n, n, t);
+        fmpz_pow_ui(t, fmpq_poly_denref(g), nf->pol->length - 1);
+        fmpq_mul_fmpz(n, n, t);
+        fmpz_set(Q, fmpq_numref(n));
+
+        use_divisor = n_randint(state, 2);
+        if (use_divisor)
+        {
+           fmpz_randtest_not_zero(t, state, 20);
+           fmpz_gcd(D, Q, t);
+           fmpz_divexact(Q, Q, D);
+           nbits = fmpz_bits(Q);
+        } else
+           nbits = 0;
+
+        smooth = nf_elem_norm_is_smooth(fac, a, nf, primes, num_primes,
+                                         use_divisor ? D : NULL, nbits);
+
+        /* trial division, the norm vanishes if f is reducible */
+        fmpz_abs(t, Q);
+        if (!fmpz_is_zero(t))
+        {
+           for (j = 0; j < num_primes; j++)
+           {
+              fmpz_set_ui(pz, primes[j]);
+              fmpz_remove(t, t, pz);
+           }
+        }
+        smooth2 = fmpz_is_one(t);
+
+        result = (smooth == smooth2);
+        if (result && smooth)
+        {
+           fmpz_factor_expand(t, fac);
+           result = fmpz_equal(t, Q);
+        }
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           nf_print(nf); printf("\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("Q = "); fmpz_print(Q); printf("\n");
+           printf("D = "); fmpz_print(D); printf("\n");
+           flint_printf("smooth = %d, smooth2 = %d\n", smooth, smooth2);
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        fmpz_factor_clear(fac);
+        fmpq_clear(n);
+        fmpq_poly_clear(g);
+        fmpz_clear(Q);
+        fmpz_clear(D);
+        fmpz_clear(t);
+        fmpz_clear(pz);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
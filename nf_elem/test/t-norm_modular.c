@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("norm_modular....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with the resultant over Q */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a;
+        fmpq_poly_t f;
+        fmpq_t n1, n2;
+        fmpz_t lead;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        do {
+           nf_init_randtest(nf, state, 40, 100);
+           if (nf->pol->length > 3)
+              break;
+           nf_clear(nf);
+        } while (1);
+
+        nf_elem_init(a, nf);
+        fmpq_poly_init(f);
+        fmpq_init(n1);
+        fmpq_init(n2);
+        fmpz_init(lead);
+
+        nf_elem_randtest(a, state, 1 + n_randint(state, 400), nf);
+
+        _nf_elem_norm_modular(fmpq_numref(n1), fmpq_denref(n1), a, nf);
+
+        /* N(a) = Res(f, a)/lead(f)^deg(a) for f with denominator 1 */
+        fmpq_poly_set(f, nf->pol);
+        fmpz_one(fmpq_poly_denref(f));
+        fmpq_poly_resultant(n2, f, NF_ELEM(a));
+        if (NF_ELEM(a)->length > 1)
+        {
+           fmpz_pow_ui(lead, fmpq_poly_numref(f) + f->length - 1,
+                                                 NF_ELEM(a)->length - 1);
+           fmpq_div_fmpz(n2, n2, lead);
+        }
+
+        result = fmpq_equal(n1, n2);
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("n1 = "); fmpq_print(n1); printf("\n");
+           printf("n2 = "); fmpq_print(n2); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        fmpq_poly_clear(f);
+        fmpq_clear(n1);
+        fmpq_clear(n2);
+        fmpz_clear(lead);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
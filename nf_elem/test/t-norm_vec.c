@@ -0,0 +1,191 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("norm_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with nf_elem_norm */
+    for (i = 0; i < 20 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a;
+        fmpq * n;
+        fmpq_t n2;
+        slong j, len;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nf_init_randtest(nf, state, 25, 100);
+
+        len = n_randint(state, 300);
+
+        a = (nf_elem_struct *) flint_malloc(len*sizeof(nf_elem_struct));
+        n = (fmpq *) flint_malloc(len*sizeof(fmpq));
+        fmpq_init(n2);
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_init(a + j, nf);
+           fmpq_init(n + j);
+
+           nf_elem_randtest(a + j, state, 1 + n_randint(state, 100), nf);
+        }
+
+        nf_elem_norm_vec(n, a, len, nf);
+
+        result = 1;
+        for (j = 0; j < len && result; j++)
+        {
+           nf_elem_norm(n2, a + j, nf);
+           result = fmpq_equal(n + j, n2);
+        }
+
+        if (!result)
+        {
+           j--;
+           printf("FAIL:\n");
+           nf_print(nf); printf("\n");
+           printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+           printf("n = "); fmpq_print(n + j); printf("\n");
+           printf("n2 = "); fmpq_print(n2); printf("\n");
+           abort();
+        }
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_clear(a + j, nf);
+           fmpq_clear(n + j);
+        }
+
+        flint_free(a);
+        flint_free(n);
+        fmpq_clear(n2);
+
+        nf_clear(nf);
+    }
+
+    /* norms modulo a product of primes */
+    for (i = 0; i < 20 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a;
+        fmpz * r;
+        mp_limb_t primes[5], p;
+        fmpz_t M, R, t;
+        fmpq_t n2;
+        fmpq_poly_t g;
+        const fmpz * lead;
+        slong j, len, num_primes;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nf_init_randtest(nf, state, 25, 100);
+        lead = fmpq_poly_numref(nf->pol) + nf->pol->length - 1;
+
+        num_primes = n_randint(state, 6);
+
+        fmpz_init_set_ui(M, 1);
+        p = n_randint(state, 1000);
+        for (j = 0; j < num_primes; )
+        {
+           p = n_nextprime(p, 0);
+           if (fmpz_fdiv_ui(lead, p) != 0)
+           {
+              primes[j++] = p;
+              fmpz_mul_ui(M, M, p);
+           }
+        }
+
+        len = n_randint(state, 300);
+
+        a = (nf_elem_struct *) flint_malloc(len*sizeof(nf_elem_struct));
+        r = _fmpz_vec_init(len);
+        fmpz_init(R);
+        fmpz_init(t);
+        fmpq_init(n2);
+        fmpq_poly_init(g);
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_init(a + j, nf);
+           nf_elem_randtest(a + j, state, 1 + n_randint(state, 100), nf);
+        }
+
+        nf_elem_norm_vec_mod(r, a, len, primes, num_primes, nf);
+
+        /* Res(f, num(a)) = N(a) lead(f)^deg(a) den(a)^deg(f) */
+        result = 1;
+        for (j = 0; j < len && result; j++)
+        {
+           nf_elem_norm(n2, a + j, nf);
+           nf_elem_get_fmpq_poly(g, a + j, nf);
+
+           if (g->length > 0)
+           {
+              fmpz_pow_ui(t, lead, g->length - 1);
+              fmpq_mul_fmpz(n2, n2, t);
+              fmpz_pow_ui(t, fmpq_poly_denref(g), nf->pol->length - 1);
+              fmpq_mul_fmpz(n2, n2, t);
+           }
+
+           result = fmpz_is_one(fmpq_denref(n2));
+
+           if (result)
+           {
+              fmpz_mod(R, fmpq_numref(n2), M);
+              result = fmpz_equal(R, r + j);
+           }
+        }
+
+        if (!result)
+        {
+           j--;
+           printf("FAIL:\n");
+           nf_print(nf); printf("\n");
+           printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+           printf("M = "); fmpz_print(M); printf("\n");
+           printf("r = "); fmpz_print(r + j); printf("\n");
+           printf("n2 = "); fmpq_print(n2); printf("\n");
+           abort();
+        }
+
+        for (j = 0; j < len; j++)
+           nf_elem_clear(a + j, nf);
+
+        flint_free(a);
+        _fmpz_vec_clear(r, len);
+        fmpz_clear(M);
+        fmpz_clear(R);
+        fmpz_clear(t);
+        fmpq_clear(n2);
+        fmpq_poly_clear(g);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -110,6 +110,102 @@ main(void)
         nf_clear(nf);
     }
     
+    /* test quadratic fields against generic powering */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p1, p2;
+        ulong exp;
+
+        nf_init_randtest(nf, state, 3, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+
+        nf_elem_randtest(a, state, 20, nf);
+        
+        exp = n_randint(state, 200) + 3;
+
+        nf_elem_pow(p1, a, exp, nf);
+
+        if (nf_elem_is_zero(a, nf))
+           nf_elem_zero(p2, nf);
+        else
+           _nf_elem_pow(p2, a, exp, nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           flint_printf("exp = %wu\n", exp);
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+         
+        nf_clear(nf);
+    }
+
+    /* test units in quadratic fields */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        fmpq_poly_t pol;
+        nf_elem_t a, p1, p2;
+        slong c0, c1;
+        ulong exp;
+
+        /* x is a unit if x^2 + c1*x +- 1 = 0, excluding (x +- 1)^2 */
+        do {
+           c1 = n_randint(state, 21) - 10;
+           c0 = n_randint(state, 2) ? 1 : -1;
+        } while (c1*c1 == 4*c0);
+
+        fmpq_poly_init(pol);
+        fmpq_poly_set_coeff_si(pol, 2, 1);
+        fmpq_poly_set_coeff_si(pol, 1, c1);
+        fmpq_poly_set_coeff_si(pol, 0, c0);
+        nf_init(nf, pol);
+        fmpq_poly_clear(pol);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+
+        nf_elem_gen(a, nf);
+        nf_elem_pow(a, a, n_randint(state, 5) + 1, nf);
+        if (n_randint(state, 2))
+           nf_elem_neg(a, a, nf);
+        
+        exp = n_randint(state, 200) + 3;
+
+        nf_elem_pow(p1, a, exp, nf);
+        _nf_elem_pow(p2, a, exp, nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           flint_printf("exp = %wu\n", exp);
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+         
+        nf_clear(nf);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -0,0 +1,202 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("pow_fmpz....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against nf_elem_pow */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p1, p2;
+        fmpz_t e;
+
+        nf_init_randtest(nf, state, 20, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+        fmpz_init(e);
+
+        nf_elem_randtest(a, state, 20, nf);
+        
+        fmpz_set_ui(e, n_randint(state, 100));
+
+        nf_elem_pow_fmpz(p1, a, e, nf);
+        nf_elem_pow(p2, a, fmpz_get_ui(e), nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+        fmpz_clear(e);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing a and res */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p;
+        fmpz_t e;
+
+        nf_init_randtest(nf, state, 20, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p, nf);
+        fmpz_init(e);
+
+        nf_elem_randtest(a, state, 20, nf);
+        
+        fmpz_set_ui(e, n_randint(state, 100));
+
+        nf_elem_pow_fmpz(p, a, e, nf);
+        nf_elem_pow_fmpz(a, a, e, nf);
+        
+        result = (nf_elem_equal(a, p, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p = "); nf_elem_print_pretty(p, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p, nf);
+        fmpz_clear(e);
+         
+        nf_clear(nf);
+    }
+
+    /* test a^e * a^-e = 1 */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p1, p2;
+        fmpz_t e;
+
+        nf_init_randtest(nf, state, 20, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+        fmpz_init(e);
+
+        do {
+           nf_elem_randtest_not_zero(a, state, 20, nf);
+        } while (!_nf_elem_invertible_check(a, nf));
+        
+        fmpz_set_ui(e, n_randint(state, 50));
+
+        nf_elem_pow_fmpz(p1, a, e, nf);
+        fmpz_neg(e, e);
+        nf_elem_pow_fmpz(p2, a, e, nf);
+        nf_elem_mul(p1, p1, p2, nf);
+        
+        result = (nf_elem_is_one(p1, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+        fmpz_clear(e);
+         
+        nf_clear(nf);
+    }
+
+    /* test large exponents in cyclotomic fields x^n + 1, n = 2^k */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        fmpq_poly_t pol;
+        nf_elem_t a, p1, p2;
+        fmpz_t e, r;
+        slong n;
+
+        n = WORD(1) << n_randint(state, 5);
+
+        fmpq_poly_init(pol);
+        fmpq_poly_set_coeff_si(pol, n, 1);
+        fmpq_poly_set_coeff_si(pol, 0, 1);
+        nf_init(nf, pol);
+        fmpq_poly_clear(pol);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+        fmpz_init(e);
+        fmpz_init(r);
+
+        /* the generator is a root of unity of order 2n */
+        nf_elem_gen(a, nf);
+        
+        fmpz_randtest_unsigned(e, state, 1000);
+        fmpz_fdiv_r_2exp(r, e, FLINT_BIT_COUNT(n));
+
+        nf_elem_pow_fmpz(p1, a, e, nf);
+        nf_elem_pow_fmpz(p2, a, r, nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+        fmpz_clear(e);
+        fmpz_clear(r);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+/* random number field with monic integral defining polynomial */
+void nf_init_randtest_monic(nf_t nf, flint_rand_t state,
+                                             slong len, mp_bitcnt_t bits)
+{
+    fmpq_poly_t pol;
+    slong i;
+
+    len = 2 + n_randint(state, len - 1);
+
+    fmpq_poly_init(pol);
+    fmpq_poly_fit_length(pol, len);
+
+    for (i = 0; i < len - 1; i++)
+       fmpz_randtest(fmpq_poly_numref(pol) + i, state, bits);
+    fmpz_one(fmpq_poly_numref(pol) + len - 1);
+
+    _fmpq_poly_set_length(pol, len);
+
+    nf_init(nf, pol);
+    fmpq_poly_clear(pol);
+}
+
+/* random integral element */
+void nf_elem_randtest_integral(nf_elem_t a, flint_rand_t state,
+                                             mp_bitcnt_t bits, const nf_t nf)
+{
+    fmpq_poly_t pol;
+    slong i, len = fmpq_poly_length(nf->pol) - 1;
+
+    fmpq_poly_init(pol);
+    fmpq_poly_fit_length(pol, len);
+
+    for (i = 0; i < len; i++)
+       fmpz_randtest(fmpq_poly_numref(pol) + i, state, bits);
+
+    _fmpq_poly_set_length(pol, len);
+    _fmpq_poly_normalise(pol);
+
+    nf_elem_set_fmpq_poly(a, pol, nf);
+    fmpq_poly_clear(pol);
+}
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("powmod_fmpz....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against nf_elem_pow and nf_elem_mod_fmpz */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p1, p2;
+        fmpz_t e, m;
+
+        nf_init_randtest_monic(nf, state, 10, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+        fmpz_init(e);
+        fmpz_init(m);
+
+        nf_elem_randtest_integral(a, state, 20, nf);
+        
+        fmpz_set_ui(e, n_randint(state, 30));
+        fmpz_randtest_not_zero(m, state, 200);
+        fmpz_abs(m, m);
+
+        nf_elem_powmod_fmpz(p1, a, e, m, nf);
+        nf_elem_pow(p2, a, fmpz_get_ui(e), nf);
+        nf_elem_mod_fmpz(p2, p2, m, nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           printf("m = "); fmpz_print(m); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+        fmpz_clear(e);
+        fmpz_clear(m);
+         
+        nf_clear(nf);
+    }
+    
+    /* test a^(e1 + e2) = a^e1 * a^e2 for large exponents */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p1, p2, p3;
+        fmpz_t e1, e2, e, m;
+
+        nf_init_randtest_monic(nf, state, 10, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p1, nf);
+        nf_elem_init(p2, nf);
+        nf_elem_init(p3, nf);
+        fmpz_init(e1);
+        fmpz_init(e2);
+        fmpz_init(e);
+        fmpz_init(m);
+
+        nf_elem_randtest_integral(a, state, 20, nf);
+        
+        fmpz_randtest_unsigned(e1, state, 200);
+        fmpz_randtest_unsigned(e2, state, 200);
+        fmpz_add(e, e1, e2);
+        fmpz_randtest_not_zero(m, state, 200);
+        fmpz_abs(m, m);
+
+        nf_elem_powmod_fmpz(p1, a, e, m, nf);
+        nf_elem_powmod_fmpz(p2, a, e1, m, nf);
+        nf_elem_powmod_fmpz(p3, a, e2, m, nf);
+        nf_elem_mul(p2, p2, p3, nf);
+        nf_elem_mod_fmpz(p2, p2, m, nf);
+        
+        result = (nf_elem_equal(p1, p2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p1 = "); nf_elem_print_pretty(p1, nf, "x"); printf("\n");
+           printf("p2 = "); nf_elem_print_pretty(p2, nf, "x"); printf("\n");
+           printf("e1 = "); fmpz_print(e1); printf("\n");
+           printf("e2 = "); fmpz_print(e2); printf("\n");
+           printf("m = "); fmpz_print(m); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p1, nf);
+        nf_elem_clear(p2, nf);
+        nf_elem_clear(p3, nf);
+        fmpz_clear(e1);
+        fmpz_clear(e2);
+        fmpz_clear(e);
+        fmpz_clear(m);
+         
+        nf_clear(nf);
+    }
+
+    /* test aliasing a and res */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, p;
+        fmpz_t e, m;
+
+        nf_init_randtest_monic(nf, state, 10, 20);
+        
+        nf_elem_init(a, nf);
+        nf_elem_init(p, nf);
+        fmpz_init(e);
+        fmpz_init(m);
+
+        nf_elem_randtest_integral(a, state, 20, nf);
+        
+        fmpz_randtest_unsigned(e, state, 100);
+        fmpz_randtest_not_zero(m, state, 200);
+        fmpz_abs(m, m);
+
+        nf_elem_powmod_fmpz(p, a, e, m, nf);
+        nf_elem_powmod_fmpz(a, a, e, m, nf);
+        
+        result = (nf_elem_equal(a, p, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+           printf("p = "); nf_elem_print_pretty(p, nf, "x"); printf("\n");
+           printf("e = "); fmpz_print(e); printf("\n");
+           printf("m = "); fmpz_print(m); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(p, nf);
+        fmpz_clear(e);
+        fmpz_clear(m);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -16,6 +16,7 @@
 ******************************************************************************/
 
 #include <stdio.h>
+#include "flint/fmpz_vec.h"
 #include "flint/fmpq_mat.h"
 #include "nf.h"
 #include "nf_elem.h"
@@ -104,6 +105,74 @@ main(void)
         nf_clear(nf);
     }
 
+    /* test _rep_mat_fmpz_mat_den without canonicalisation */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t b;
+        slong d, j;
+        fmpz_mat_t R, S;
+        fmpq_mat_t Q1, Q2;
+        fmpz_t den1, den2, g;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        d = fmpq_poly_degree(nf->pol);
+
+        fmpz_mat_init(R, d, d);
+        fmpz_mat_init(S, d, d);
+        fmpq_mat_init(Q1, d, d);
+        fmpq_mat_init(Q2, d, d);
+        fmpz_init(den1);
+        fmpz_init(den2);
+        fmpz_init(g);
+
+        nf_elem_init(b, nf);
+
+        nf_elem_randtest(b, state, 100, nf);
+
+        nf_elem_rep_mat_fmpz_mat_den(R, den1, b, nf);
+        _nf_elem_rep_mat_fmpz_mat_den(S, den2, b, nf, 0);
+
+        fmpq_mat_set_fmpz_mat_div_fmpz(Q1, R, den1);
+        fmpq_mat_set_fmpz_mat_div_fmpz(Q2, S, den2);
+
+        /* the canonical form must also be primitive */
+        fmpz_set(g, den1);
+        for (j = 0; j < d; j++)
+        {
+            fmpz_t c;
+            fmpz_init(c);
+            _fmpz_vec_content(c, R->rows[j], d);
+            fmpz_gcd(g, g, c);
+            fmpz_clear(c);
+        }
+
+        if (!fmpq_mat_equal(Q1, Q2) || fmpz_sgn(den2) <= 0 || !fmpz_is_one(g)
+            || !fmpz_divisible(den2, den1))
+        {
+            printf("FAIL:\n");
+            printf("R = "); fmpz_mat_print_pretty(R); printf("\n");
+            printf("den1 = "); fmpz_print(den1); printf("\n");
+            printf("S = "); fmpz_mat_print_pretty(S); printf("\n");
+            printf("den2 = "); fmpz_print(den2); printf("\n");
+            printf("K = "); nf_print(nf); printf("\n");
+            printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+            abort();
+        }
+
+        nf_elem_clear(b, nf);
+        fmpz_mat_clear(R);
+        fmpz_mat_clear(S);
+        fmpq_mat_clear(Q1);
+        fmpq_mat_clear(Q2);
+        fmpz_clear(den1);
+        fmpz_clear(den2);
+        fmpz_clear(g);
+
+        nf_clear(nf);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("trace_form_mat....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* check entries against traces of powers of the generator */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t g, p;
+        fmpq_mat_t T, T2;
+        fmpq_t t;
+        slong j, k, d;
+
+        nf_init_randtest(nf, state, 15, 50);
+        d = fmpq_poly_degree(nf->pol);
+
+        nf_elem_init(g, nf);
+        nf_elem_init(p, nf);
+        fmpq_mat_init(T, d, d);
+        fmpq_mat_init(T2, d, d);
+        fmpq_init(t);
+
+        nf_elem_trace_form_mat(T, nf);
+
+        nf_precompute(nf, NF_PRECOMP_TRACE_FORM);
+        nf_elem_trace_form_mat(T2, nf); /* precomputed */
+
+        nf_elem_gen(g, nf);
+
+        result = fmpq_mat_equal(T, T2);
+        for (j = 0; j < d && result; j++)
+        {
+           for (k = 0; k < d && result; k++)
+           {
+              nf_elem_pow(p, g, j + k, nf);
+              nf_elem_trace(t, p, nf);
+
+              result = fmpq_equal(t, fmpq_mat_entry(T, j, k));
+           }
+        }
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           nf_print(nf); printf("\n");
+           printf("T = "); fmpq_mat_print(T); printf("\n");
+           printf("T2 = "); fmpq_mat_print(T2); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(g, nf);
+        nf_elem_clear(p, nf);
+        fmpq_mat_clear(T);
+        fmpq_mat_clear(T2);
+        fmpq_clear(t);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "flint/fmpq.h"
+#include "flint/fmpq_vec.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("trace_powers....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with powering and taking traces */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a, b;
+        fmpq * res;
+        fmpq_t t;
+        slong d, n, k;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        d = fmpq_poly_degree(nf->pol);
+        n = n_randint(state, 3*d + 2);
+
+        nf_elem_init(a, nf);
+        nf_elem_init(b, nf);
+        fmpq_init(t);
+        res = _fmpq_vec_init(n);
+
+        nf_elem_randtest(a, state, 20, nf);
+
+        nf_elem_trace_powers(res, a, n, nf);
+
+        nf_elem_one(b, nf);
+
+        for (k = 1; k <= n; k++)
+        {
+            nf_elem_mul(b, b, a, nf);
+            nf_elem_trace(t, b, nf);
+
+            result = fmpq_equal(t, res + k - 1);
+            if (!result)
+            {
+                printf("FAIL:\n");
+                printf("K = "); nf_print(nf); printf("\n");
+                printf("a = "); nf_elem_print_pretty(a, nf, "x"); printf("\n");
+                flint_printf("k = %wd\n", k);
+                printf("t = "); fmpq_print(t); printf("\n");
+                printf("res = "); fmpq_print(res + k - 1); printf("\n");
+                abort();
+            }
+        }
+
+        nf_elem_clear(a, nf);
+        nf_elem_clear(b, nf);
+        fmpq_clear(t);
+        _fmpq_vec_clear(res, n);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("trace_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with nf_elem_trace */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a;
+        fmpq * t;
+        fmpz * tnum;
+        fmpz_t tden;
+        fmpq_t t2, t3;
+        slong j, len;
+
+        nf_init_randtest(nf, state, 25, 200);
+
+        len = n_randint(state, 20);
+
+        a = (nf_elem_struct *) flint_malloc(len*sizeof(nf_elem_struct));
+        t = (fmpq *) flint_malloc(len*sizeof(fmpq));
+        tnum = _fmpz_vec_init(len);
+        fmpz_init(tden);
+        fmpq_init(t2);
+        fmpq_init(t3);
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_init(a + j, nf);
+           fmpq_init(t + j);
+
+           nf_elem_randtest(a + j, state, 200, nf);
+        }
+
+        nf_elem_trace_vec(t, a, len, nf);
+        _nf_elem_trace_vec(tnum, tden, a, len, nf);
+
+        result = 1;
+        for (j = 0; j < len && result; j++)
+        {
+           nf_elem_trace(t2, a + j, nf);
+
+           fmpz_set(fmpq_numref(t3), tnum + j);
+           fmpz_set(fmpq_denref(t3), tden);
+           fmpq_canonicalise(t3);
+
+           result = fmpq_equal(t + j, t2) && fmpq_equal(t3, t2);
+        }
+
+        if (!result)
+        {
+           j--;
+           printf("FAIL:\n");
+           printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+           printf("t = "); fmpq_print(t + j); printf("\n");
+           printf("t2 = "); fmpq_print(t2); printf("\n");
+           printf("t3 = "); fmpq_print(t3); printf("\n");
+           abort();
+        }
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_clear(a + j, nf);
+           fmpq_clear(t + j);
+        }
+
+        flint_free(a);
+        flint_free(t);
+        _fmpz_vec_clear(tnum, len);
+        fmpz_clear(tden);
+        fmpq_clear(t2);
+        fmpq_clear(t3);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("write_bin....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test reading back a sequence of elements */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t a[4], b;
+        fmpz_t den;
+        nf_bin_stream_t s;
+        unsigned char * buf;
+        slong size, j;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        fmpz_init(den);
+        nf_elem_init(b, nf);
+
+        for (j = 0; j < 4; j++)
+        {
+           nf_elem_init(a[j], nf);
+           nf_elem_randtest(a[j], state, 200, nf);
+        }
+
+        /* a shared denominator which is sometimes that of a[0] */
+        if (n_randint(state, 2))
+           fmpz_randtest_unsigned(den, state, 100);
+        else if (nf->flag & NF_LINEAR)
+           fmpz_set(den, LNF_ELEM_DENREF(a[0]));
+        else if (nf->flag & NF_QUADRATIC)
+           fmpz_set(den, QNF_ELEM_DENREF(a[0]));
+        else
+           fmpz_set(den, NF_ELEM_DENREF(a[0]));
+
+        nf_bin_stream_init_buf(s, NULL, 0);
+        nf_elem_write_bin(s, a[0], nf);
+        nf_elem_write_bin(s, a[1], nf);
+        _nf_elem_write_bin(s, a[2], den, nf);
+        _nf_elem_write_bin(s, a[3], den, nf);
+        size = s->pos;
+
+        buf = (unsigned char *) flint_malloc(size);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = nf_elem_write_bin(s, a[0], nf) && nf_elem_write_bin(s, a[1], nf)
+              && _nf_elem_write_bin(s, a[2], den, nf)
+              && _nf_elem_write_bin(s, a[3], den, nf);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        for (j = 0; j < 4 && result; j++)
+        {
+           if (j < 2)
+              result = nf_elem_read_bin(b, s, nf);
+           else
+              result = _nf_elem_read_bin(b, s, den, nf);
+
+           result = result && nf_elem_equal(a[j], b, nf);
+        }
+
+        result = result && s->pos == size;
+
+        /* reading past the end fails */
+        result = result && !nf_elem_read_bin(b, s, nf);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           flint_printf("j = %wd\n", j);
+           /* j is one past the entry which failed, or 0 if writing did */
+           if (j > 0)
+           {
+              printf("a = "); nf_elem_print_pretty(a[j - 1], nf, "x"); printf("\n");
+              printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+           }
+           abort();
+        }
+
+        for (j = 0; j < 4; j++)
+           nf_elem_clear(a[j], nf);
+
+        nf_elem_clear(b, nf);
+        fmpz_clear(den);
+        flint_free(buf);
+
+        nf_clear(nf);
+    }
+
+    /* test that non-canonical elements are rejected */
+    for (i = 0; i < 20 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_t b;
+        fmpz_t c, g;
+        nf_bin_stream_t s;
+        unsigned char buf[64];
+        slong size;
+        int zero;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        nf_elem_init(b, nf);
+        fmpz_init(c);
+        fmpz_init(g);
+
+        /* either 0/g, or g*c/g with a common factor g > 1 */
+        zero = n_randint(state, 2);
+        fmpz_set_ui(g, 2 + n_randint(state, 100));
+        fmpz_randtest_not_zero(c, state, 100);
+        fmpz_mul(c, c, g);
+
+        nf_bin_stream_init_buf(s, buf, sizeof(buf));
+        _nf_bin_write_ui(s, zero ? 0 : 2);
+        _nf_bin_write_fmpz(s, g);
+        if (!zero)
+           _nf_bin_write_fmpz(s, c);
+        size = s->pos;
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = !nf_elem_read_bin(b, s, nf) && s->error && nf_elem_is_zero(b, nf);
+
+        if (!result)
+        {
+           printf("FAIL (non-canonical):\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           flint_printf("zero = %d, g = ", zero); fmpz_print(g); printf("\n");
+           printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(b, nf);
+        fmpz_clear(c);
+        fmpz_clear(g);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
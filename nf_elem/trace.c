@@ -19,7 +19,17 @@
 
 void _nf_elem_trace(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
 {
+   fmpq_poly_t t;
+   const fmpq_poly_struct * traces = nf->traces;
    slong i;
+
+   /* traces which have not been precomputed are computed for this call */
+   if (!(nf->flag & NF_LINEAR) && !(nf->precomp & NF_PRECOMP_TRACES))
+   {
+      fmpq_poly_init2(t, fmpq_poly_degree(nf->pol));
+      _nf_traces(fmpq_poly_numref(t), fmpq_poly_denref(t), nf);
+      traces = t;
+   }
    
    if (nf->flag & NF_LINEAR)
    {
@@ -32,8 +42,8 @@ void _nf_elem_trace(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
    {
       const fmpz * const anum = QNF_ELEM_NUMREF(a);
       const fmpz * const aden = QNF_ELEM_DENREF(a);
-      const fmpz * const tnum = fmpq_poly_numref(nf->traces);
-      const fmpz * const tden = fmpq_poly_denref(nf->traces);
+      const fmpz * const tnum = fmpq_poly_numref(traces);
+      const fmpz * const tden = fmpq_poly_denref(traces);
       
       slong alen = 2;
       while (alen > 0 && fmpz_is_zero(anum + alen - 1))
@@ -58,8 +68,8 @@ void _nf_elem_trace(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
    {
       const fmpz * const anum = NF_ELEM_NUMREF(a);
       const fmpz * const aden = NF_ELEM_DENREF(a);
-      const fmpz * const tnum = fmpq_poly_numref(nf->traces);
-      const fmpz * const tden = fmpq_poly_denref(nf->traces);
+      const fmpz * const tnum = fmpq_poly_numref(traces);
+      const fmpz * const tden = fmpq_poly_denref(traces);
       
       slong alen = NF_ELEM(a)->length;
       
@@ -78,7 +88,10 @@ void _nf_elem_trace(fmpz_t rnum, fmpz_t rden, const nf_elem_t a, const nf_t nf)
       
          _fmpq_canonicalise(rnum, rden);
       }
-   }   
+   }
+
+   if (traces == t)
+      fmpq_poly_clear(t);
 }
 
 void nf_elem_trace(fmpq_t res, const nf_elem_t a, const nf_t nf)
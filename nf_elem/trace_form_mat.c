@@ -0,0 +1,20 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem.h"
+
+void nf_elem_trace_form_mat(fmpq_mat_t res, const nf_t nf)
+{
+   if (nf->precomp & NF_PRECOMP_TRACE_FORM)
+      fmpq_mat_set(res, nf->trace_form);
+   else
+      _nf_trace_form(res, nf);
+}
@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpq.h"
+#include "nf_elem.h"
+
+void nf_elem_trace_powers(fmpq * res, const nf_elem_t a, slong n, const nf_t nf)
+{
+   const slong d = fmpq_poly_degree(nf->pol);
+   const slong m = FLINT_MIN(n, d);
+   nf_elem_struct * pows;
+   fmpq_poly_t S, R, Q;
+   fmpq_t c;
+   slong k;
+
+   if (n <= 0)
+      return;
+
+   /* Tr(a^k) for k <= d from the powers of a and the cached traces */
+   pows = (nf_elem_struct *) flint_malloc(m*sizeof(nf_elem_struct));
+
+   for (k = 0; k < m; k++)
+      nf_elem_init(pows + k, nf);
+
+   nf_elem_set(pows + 0, a, nf);
+   for (k = 1; k < m; k++)
+      nf_elem_mul(pows + k, pows + k - 1, a, nf);
+
+   nf_elem_trace_vec(res, pows, m, nf);
+
+   for (k = 0; k < m; k++)
+      nf_elem_clear(pows + k, nf);
+
+   flint_free(pows);
+
+   if (n == m)
+      return;
+
+   /*
+      The first d power sums p_k determine the reversed characteristic
+      polynomial R(t) = exp(-sum p_k t^k/k) of a, and all power sums are
+      then given by sum p_k t^k = -t R'(t)/R(t).
+   */
+   fmpq_poly_init(S);
+   fmpq_poly_init(R);
+   fmpq_poly_init(Q);
+   fmpq_init(c);
+
+   for (k = 1; k <= d; k++)
+   {
+      fmpq_set_si(c, -1, k);
+      fmpq_mul(c, c, res + k - 1);
+      fmpq_poly_set_coeff_fmpq(S, k, c);
+   }
+
+   fmpq_poly_exp_series(R, S, d + 1);
+   fmpq_poly_derivative(Q, R);
+   fmpq_poly_div_series(Q, Q, R, n);
+
+   for (k = d + 1; k <= n; k++)
+   {
+      fmpq_poly_get_coeff_fmpq(res + k - 1, Q, k - 1);
+      fmpq_neg(res + k - 1, res + k - 1);
+   }
+
+   fmpq_poly_clear(S);
+   fmpq_poly_clear(R);
+   fmpq_poly_clear(Q);
+   fmpq_clear(c);
+}
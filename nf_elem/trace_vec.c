@@ -0,0 +1,128 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz_mat.h"
+#include "nf_elem.h"
+
+/* numerator, denominator and length of the numerator of a */
+static void
+_nf_elem_trace_vec_get(const fmpz ** anum, const fmpz ** aden, slong * alen,
+                                          const nf_elem_t a, const nf_t nf)
+{
+   if (nf->flag & NF_LINEAR)
+   {
+      *anum = LNF_ELEM_NUMREF(a);
+      *aden = LNF_ELEM_DENREF(a);
+      *alen = 1;
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      *anum = QNF_ELEM_NUMREF(a);
+      *aden = QNF_ELEM_DENREF(a);
+      *alen = 2;
+   } else
+   {
+      *anum = NF_ELEM_NUMREF(a);
+      *aden = NF_ELEM_DENREF(a);
+      *alen = NF_ELEM(a)->length;
+   }
+}
+
+void _nf_elem_trace_vec(fmpz * rnum, fmpz_t rden,
+                       const nf_elem_struct * a, slong len, const nf_t nf)
+{
+   const slong d = fmpq_poly_degree(nf->pol);
+   const fmpz * anum, * aden;
+   fmpz_mat_t A, T, R;
+   fmpq_poly_t t;
+   const fmpq_poly_struct * traces = nf->traces;
+   fmpz_t s;
+   slong i, j, alen;
+
+   fmpz_one(rden);
+
+   if (len == 0)
+      return;
+
+   /* traces which have not been precomputed are computed for this call */
+   if (!(nf->precomp & NF_PRECOMP_TRACES))
+   {
+      fmpq_poly_init2(t, d);
+      _nf_traces(fmpq_poly_numref(t), fmpq_poly_denref(t), nf);
+      traces = t;
+   }
+
+   /* common denominator of the elements */
+   for (i = 0; i < len; i++)
+   {
+      _nf_elem_trace_vec_get(&anum, &aden, &alen, a + i, nf);
+      fmpz_lcm(rden, rden, aden);
+   }
+
+   fmpz_mat_init(A, len, d);
+   fmpz_mat_init(T, d, 1);
+   fmpz_mat_init(R, len, 1);
+   fmpz_init(s);
+
+   /* row i holds the numerator of a_i over the common denominator */
+   for (i = 0; i < len; i++)
+   {
+      _nf_elem_trace_vec_get(&anum, &aden, &alen, a + i, nf);
+
+      if (fmpz_equal(aden, rden))
+         _fmpz_vec_set(A->rows[i], anum, alen);
+      else
+      {
+         fmpz_divexact(s, rden, aden);
+         _fmpz_vec_scalar_mul_fmpz(A->rows[i], anum, alen, s);
+      }
+   }
+
+   for (j = 0; j < d; j++)
+      fmpz_set(fmpz_mat_entry(T, j, 0), fmpq_poly_numref(traces) + j);
+
+   fmpz_mat_mul(R, A, T);
+
+   for (i = 0; i < len; i++)
+      fmpz_swap(rnum + i, fmpz_mat_entry(R, i, 0));
+
+   fmpz_mul(rden, rden, fmpq_poly_denref(traces));
+
+   fmpz_mat_clear(A);
+   fmpz_mat_clear(T);
+   fmpz_mat_clear(R);
+   fmpz_clear(s);
+
+   if (traces == t)
+      fmpq_poly_clear(t);
+}
+
+void nf_elem_trace_vec(fmpq * res, const nf_elem_struct * a,
+                                               slong len, const nf_t nf)
+{
+   fmpz * rnum;
+   fmpz_t rden;
+   slong i;
+
+   rnum = _fmpz_vec_init(len);
+   fmpz_init(rden);
+
+   _nf_elem_trace_vec(rnum, rden, a, len, nf);
+
+   for (i = 0; i < len; i++)
+   {
+      fmpz_swap(fmpq_numref(res + i), rnum + i);
+      fmpz_set(fmpq_denref(res + i), rden);
+      fmpq_canonicalise(res + i);
+   }
+
+   _fmpz_vec_clear(rnum, len);
+   fmpz_clear(rden);
+}
@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem.h"
+
+/*
+   An element is written as a word 2*len + f, where f = 1 if its denominator
+   is the shared denominator and is omitted, followed by the denominator if
+   present and the len coefficients of the numerator.
+*/
+int _nf_elem_write_bin(nf_bin_stream_t s, const nf_elem_t a,
+                                         const fmpz_t den, const nf_t nf)
+{
+   const fmpz * anum, * aden;
+   slong i, alen;
+   int shared;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      anum = LNF_ELEM_NUMREF(a);
+      aden = LNF_ELEM_DENREF(a);
+      alen = !fmpz_is_zero(anum);
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      anum = QNF_ELEM_NUMREF(a);
+      aden = QNF_ELEM_DENREF(a);
+      alen = 2;
+      while (alen > 0 && fmpz_is_zero(anum + alen - 1))
+         alen--;
+   } else
+   {
+      anum = NF_ELEM_NUMREF(a);
+      aden = NF_ELEM_DENREF(a);
+      alen = NF_ELEM(a)->length;
+   }
+
+   shared = fmpz_equal(aden, den);
+
+   _nf_bin_write_ui(s, 2*alen + shared);
+
+   if (!shared)
+      _nf_bin_write_fmpz(s, aden);
+
+   for (i = 0; i < alen; i++)
+      _nf_bin_write_fmpz(s, anum + i);
+
+   return !s->error;
+}
+
+int nf_elem_write_bin(nf_bin_stream_t s, const nf_elem_t a, const nf_t nf)
+{
+   fmpz_t one;
+   int res;
+
+   fmpz_init_set_ui(one, 1);
+   res = _nf_elem_write_bin(s, a, one, nf);
+   fmpz_clear(one);
+
+   return res;
+}
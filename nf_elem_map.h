@@ -0,0 +1,173 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#ifndef NF_ELEM_MAP_H
+#define NF_ELEM_MAP_H
+
+#ifdef NF_ELEM_MAP_INLINES_C
+#define NF_ELEM_MAP_INLINE ANTIC_DLL
+#else
+#define NF_ELEM_MAP_INLINE static __inline__
+#endif
+
+#include "gmp.h"
+#include "flint/flint.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* minimum number of keys per thread when hashing a vector of keys */
+#define NF_ELEM_MAP_HASH_THREAD_CUTOFF 1024
+
+/* multiplier for Fibonacci hashing of fingerprints into slots */
+#if FLINT64
+#define NF_ELEM_MAP_MIX UWORD(0x9e3779b97f4a7c15)
+#else
+#define NF_ELEM_MAP_MIX UWORD(0x9e3779b9)
+#endif
+
+/*
+   Open addressing hash map from number field elements to slong values.
+   The keys are stored in insertion order in a single arena of coefficients,
+   each as its denominator followed by its numerator, and the table holds
+   indices into the arrays of offsets, values and fingerprints.
+*/
+typedef struct
+{
+   fmpz * coeffs;         /* denominator and numerator of each key */
+   slong coeffs_alloc;    /* number of coefficients allocated */
+   slong * offs;          /* key i is coeffs[offs[i]] to coeffs[offs[i + 1] - 1] */
+   slong * vals;          /* value associated with each key */
+   ulong * hashes;        /* fingerprint of each key */
+   slong length;          /* number of keys */
+   slong alloc;           /* number of keys allocated */
+   slong * table;         /* index of key or -1, linear probing */
+   slong table_size;      /* a power of two, at least twice the length */
+} nf_elem_map_struct;
+
+typedef nf_elem_map_struct nf_elem_map_t[1];
+
+/******************************************************************************
+
+    Memory management
+
+******************************************************************************/
+
+ANTIC_DLL void nf_elem_map_init(nf_elem_map_t map, const nf_t nf);
+
+ANTIC_DLL void nf_elem_map_clear(nf_elem_map_t map, const nf_t nf);
+
+ANTIC_DLL void nf_elem_map_fit_length(nf_elem_map_t map,
+                                                  slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_map_rehash(nf_elem_map_t map, slong size);
+
+/******************************************************************************
+
+    Basic manipulation
+
+******************************************************************************/
+
+NF_ELEM_MAP_INLINE
+slong nf_elem_map_length(const nf_elem_map_t map)
+{
+   return map->length;
+}
+
+ANTIC_DLL void nf_elem_map_get_key(nf_elem_t a, const nf_elem_map_t map,
+                                                    slong i, const nf_t nf);
+
+NF_ELEM_MAP_INLINE
+slong nf_elem_map_value(const nf_elem_map_t map, slong i)
+{
+   return map->vals[i];
+}
+
+/******************************************************************************
+
+    Insertion and lookup
+
+******************************************************************************/
+
+/*
+   The top bits of h times an odd constant, so that fingerprints which agree
+   in their low bits, e.g. of multiples of a power of two, are spread out.
+*/
+NF_ELEM_MAP_INLINE
+ulong _nf_elem_map_slot(ulong h, slong size)
+{
+   const ulong bits = FLINT_BIT_COUNT(size - 1);
+
+   return bits == 0 ? 0 : (h*NF_ELEM_MAP_MIX) >> (FLINT_BITS - bits);
+}
+
+/*
+   The numerator of a, with its length without trailing zeros and its
+   denominator, as they are stored in the arena.
+*/
+NF_ELEM_MAP_INLINE
+const fmpz * _nf_elem_map_numden(slong * len, const fmpz ** den,
+                                           const nf_elem_t a, const nf_t nf)
+{
+   const fmpz * num;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      num = LNF_ELEM_NUMREF(a);
+      *den = LNF_ELEM_DENREF(a);
+      *len = !fmpz_is_zero(num);
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      num = QNF_ELEM_NUMREF(a);
+      *den = QNF_ELEM_DENREF(a);
+      *len = 2;
+      while (*len > 0 && fmpz_is_zero(num + *len - 1))
+         (*len)--;
+   } else
+   {
+      num = NF_ELEM_NUMREF(a);
+      *den = NF_ELEM_DENREF(a);
+      *len = NF_ELEM(a)->length;
+   }
+
+   return num;
+}
+
+ANTIC_DLL slong _nf_elem_map_find(const nf_elem_map_t map,
+                              const nf_elem_t a, ulong h, const nf_t nf);
+
+ANTIC_DLL slong nf_elem_map_find(const nf_elem_map_t map,
+                                          const nf_elem_t a, const nf_t nf);
+
+ANTIC_DLL slong _nf_elem_map_insert(nf_elem_map_t map, const nf_elem_t a,
+                                         ulong h, slong val, const nf_t nf);
+
+ANTIC_DLL slong nf_elem_map_insert(nf_elem_map_t map, const nf_elem_t a,
+                                                  slong val, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_map_hash_vec(ulong * h, const nf_elem_struct * a,
+                                                   slong len, const nf_t nf);
+
+ANTIC_DLL void nf_elem_map_find_vec(slong * idx, const nf_elem_map_t map,
+                     const nf_elem_struct * a, slong len, const nf_t nf);
+
+ANTIC_DLL void nf_elem_map_insert_vec(slong * idx, nf_elem_map_t map,
+                      const nf_elem_struct * a, const slong * vals,
+                                                   slong len, const nf_t nf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
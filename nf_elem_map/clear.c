@@ -0,0 +1,22 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_clear(nf_elem_map_t map, const nf_t nf)
+{
+   _fmpz_vec_clear(map->coeffs, map->coeffs_alloc);
+
+   flint_free(map->offs);
+   flint_free(map->vals);
+   flint_free(map->hashes);
+   flint_free(map->table);
+}
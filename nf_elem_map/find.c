@@ -0,0 +1,49 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+slong _nf_elem_map_find(const nf_elem_map_t map,
+                               const nf_elem_t a, ulong h, const nf_t nf)
+{
+   const ulong mask = map->table_size - 1;
+   const fmpz * anum, * aden, * key;
+   slong i, alen;
+   ulong j;
+
+   if (map->table_size == 0)
+      return -1;
+
+   anum = _nf_elem_map_numden(&alen, &aden, a, nf);
+
+   /*
+      fingerprints are compared first, and a match is confirmed directly
+      on the stored coefficients, as both elements are canonical
+   */
+   for (j = _nf_elem_map_slot(h, map->table_size); (i = map->table[j]) != -1; j = (j + 1) & mask)
+   {
+      if (map->hashes[i] != h || map->offs[i + 1] - map->offs[i] != alen + 1)
+         continue;
+
+      key = map->coeffs + map->offs[i];
+
+      if (fmpz_equal(key, aden) && _fmpz_vec_equal(key + 1, anum, alen))
+         return i;
+   }
+
+   return -1;
+}
+
+slong nf_elem_map_find(const nf_elem_map_t map,
+                                           const nf_elem_t a, const nf_t nf)
+{
+   return _nf_elem_map_find(map, a, nf_elem_hash(a, nf), nf);
+}
@@ -0,0 +1,31 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_find_vec(slong * idx, const nf_elem_map_t map,
+                      const nf_elem_struct * a, slong len, const nf_t nf)
+{
+   ulong * h;
+   slong i;
+
+   if (len <= 0)
+      return;
+
+   h = (ulong *) flint_malloc(len*sizeof(ulong));
+
+   _nf_elem_map_hash_vec(h, a, len, nf);
+
+   for (i = 0; i < len; i++)
+      idx[i] = _nf_elem_map_find(map, a + i, h[i], nf);
+
+   flint_free(h);
+}
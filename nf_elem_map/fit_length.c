@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_fit_length(nf_elem_map_t map, slong len, const nf_t nf)
+{
+   slong size;
+
+   if (len > map->alloc)
+   {
+      slong alloc = FLINT_MAX(len, 2*map->alloc);
+
+      /* one more offset than keys, the first of which is zero */
+      map->offs = (slong *)
+                flint_realloc(map->offs, (alloc + 1)*sizeof(slong));
+      map->offs[0] = 0;
+      map->vals = (slong *) flint_realloc(map->vals, alloc*sizeof(slong));
+      map->hashes = (ulong *) flint_realloc(map->hashes, alloc*sizeof(ulong));
+
+      map->alloc = alloc;
+   }
+
+   /* keep the load factor at most 1/2 */
+   if (2*len > map->table_size)
+   {
+      size = FLINT_MAX(map->table_size, 16);
+
+      while (size < 2*len)
+         size *= 2;
+
+      _nf_elem_map_rehash(map, size);
+   }
+}
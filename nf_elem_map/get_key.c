@@ -0,0 +1,40 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_get_key(nf_elem_t a, const nf_elem_map_t map,
+                                                    slong i, const nf_t nf)
+{
+   const fmpz * key = map->coeffs + map->offs[i];
+   slong len = map->offs[i + 1] - map->offs[i] - 1;
+
+   if (nf->flag & NF_LINEAR)
+   {
+      fmpz_set(LNF_ELEM_DENREF(a), key);
+
+      if (len == 0)
+         fmpz_zero(LNF_ELEM_NUMREF(a));
+      else
+         fmpz_set(LNF_ELEM_NUMREF(a), key + 1);
+   } else if (nf->flag & NF_QUADRATIC)
+   {
+      fmpz_set(QNF_ELEM_DENREF(a), key);
+      _fmpz_vec_set(QNF_ELEM_NUMREF(a), key + 1, len);
+      _fmpz_vec_zero(QNF_ELEM_NUMREF(a) + len, 3 - len);
+   } else
+   {
+      fmpq_poly_fit_length(NF_ELEM(a), len);
+      fmpz_set(NF_ELEM_DENREF(a), key);
+      _fmpz_vec_set(NF_ELEM_NUMREF(a), key + 1, len);
+      _fmpq_poly_set_length(NF_ELEM(a), len);
+   }
+}
@@ -0,0 +1,81 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/thread_support.h"
+#include "nf_elem_map.h"
+
+typedef struct
+{
+   ulong * h;
+   const nf_elem_struct * a;
+   slong len;
+   const nf_struct * nf;
+} _hash_vec_arg_struct;
+
+static void
+_nf_elem_map_hash_vec_worker(void * varg)
+{
+   _hash_vec_arg_struct * arg = (_hash_vec_arg_struct *) varg;
+   slong i;
+
+   for (i = 0; i < arg->len; i++)
+      arg->h[i] = nf_elem_hash(arg->a + i, arg->nf);
+}
+
+void _nf_elem_map_hash_vec(ulong * h, const nf_elem_struct * a,
+                                                   slong len, const nf_t nf)
+{
+   thread_pool_handle * threads;
+   _hash_vec_arg_struct * args;
+   slong i, start, num_threads, num_workers;
+
+   num_threads = FLINT_MIN(flint_get_num_threads(),
+                                 len/NF_ELEM_MAP_HASH_THREAD_CUTOFF);
+
+   if (num_threads <= 1)
+   {
+      for (i = 0; i < len; i++)
+         h[i] = nf_elem_hash(a + i, nf);
+
+      return;
+   }
+
+   num_workers = flint_request_threads(&threads, num_threads);
+
+   args = (_hash_vec_arg_struct *)
+             flint_malloc((num_workers + 1)*sizeof(_hash_vec_arg_struct));
+
+   start = 0;
+   for (i = 0; i <= num_workers; i++)
+   {
+      slong end = ((i + 1)*len)/(num_workers + 1);
+
+      args[i].h = h + start;
+      args[i].a = a + start;
+      args[i].len = end - start;
+      args[i].nf = nf;
+
+      start = end;
+   }
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wake(global_thread_pool, threads[i], 0,
+                                   _nf_elem_map_hash_vec_worker, &args[i]);
+
+   _nf_elem_map_hash_vec_worker(&args[num_workers]);
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wait(global_thread_pool, threads[i]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   flint_free(args);
+}
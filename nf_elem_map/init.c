@@ -0,0 +1,25 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_init(nf_elem_map_t map, const nf_t nf)
+{
+   map->coeffs = NULL;
+   map->coeffs_alloc = 0;
+   map->offs = NULL;
+   map->vals = NULL;
+   map->hashes = NULL;
+   map->length = 0;
+   map->alloc = 0;
+   map->table = NULL;
+   map->table_size = 0;
+}
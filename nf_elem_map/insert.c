@@ -0,0 +1,63 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+slong _nf_elem_map_insert(nf_elem_map_t map, const nf_elem_t a,
+                                          ulong h, slong val, const nf_t nf)
+{
+   slong i = _nf_elem_map_find(map, a, h, nf);
+   const fmpz * anum, * aden;
+   slong alen, off;
+   ulong j, mask;
+
+   if (i != -1)
+      return i;
+
+   i = map->length;
+
+   nf_elem_map_fit_length(map, i + 1, nf);
+
+   anum = _nf_elem_map_numden(&alen, &aden, a, nf);
+   off = map->offs[i];
+
+   if (off + alen + 1 > map->coeffs_alloc)
+   {
+      slong alloc = FLINT_MAX(off + alen + 1, 2*map->coeffs_alloc);
+
+      map->coeffs = (fmpz *) flint_realloc(map->coeffs, alloc*sizeof(fmpz));
+      _fmpz_vec_zero(map->coeffs + map->coeffs_alloc,
+                                             alloc - map->coeffs_alloc);
+      map->coeffs_alloc = alloc;
+   }
+
+   mask = map->table_size - 1;
+
+   for (j = _nf_elem_map_slot(h, map->table_size); map->table[j] != -1; j = (j + 1) & mask) ;
+
+   map->table[j] = i;
+
+   fmpz_set(map->coeffs + off, aden);
+   _fmpz_vec_set(map->coeffs + off + 1, anum, alen);
+   map->offs[i + 1] = off + alen + 1;
+   map->vals[i] = val;
+   map->hashes[i] = h;
+
+   map->length = i + 1;
+
+   return i;
+}
+
+slong nf_elem_map_insert(nf_elem_map_t map, const nf_elem_t a,
+                                                   slong val, const nf_t nf)
+{
+   return _nf_elem_map_insert(map, a, nf_elem_hash(a, nf), val, nf);
+}
@@ -0,0 +1,40 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void nf_elem_map_insert_vec(slong * idx, nf_elem_map_t map,
+                       const nf_elem_struct * a, const slong * vals,
+                                                   slong len, const nf_t nf)
+{
+   ulong * h;
+   slong i, j;
+
+   if (len <= 0)
+      return;
+
+   h = (ulong *) flint_malloc(len*sizeof(ulong));
+
+   _nf_elem_map_hash_vec(h, a, len, nf);
+
+   /* avoid rehashing more than once, assuming most keys are new */
+   nf_elem_map_fit_length(map, map->length + len, nf);
+
+   for (i = 0; i < len; i++)
+   {
+      j = _nf_elem_map_insert(map, a + i, h[i], vals == NULL ? 0 : vals[i], nf);
+
+      if (idx != NULL)
+         idx[i] = j;
+   }
+
+   flint_free(h);
+}
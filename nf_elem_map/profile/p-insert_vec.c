@@ -0,0 +1,122 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+#include "nf_elem_map.h"
+
+#define BITS 20
+
+#define NUM 100000
+
+typedef struct
+{
+   slong length;
+   int vec;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j;
+   int vec = info->vec;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_map_t map;
+   nf_elem_struct * a;
+
+   fmpq_poly_init(pol);
+
+   for (i = 0; i < count; i++)
+   {
+      do {
+         fmpq_poly_randtest_not_zero(pol, state, length, BITS);
+      } while (pol->length != length);
+	
+      nf_init(nf, pol);
+       
+      a = _nf_elem_vec_init(NUM, nf);
+
+      /* half of the elements are repeated */
+      _nf_elem_vec_randtest(a, state, NUM/2, BITS, nf);
+      for (j = NUM/2; j < NUM; j++)
+         nf_elem_set(a + j, a + n_randint(state, NUM/2), nf);
+
+      nf_elem_map_init(map, nf);
+
+      prof_start();
+      if (vec)
+         nf_elem_map_insert_vec(NULL, map, a, NULL, NUM, nf);
+      else
+      {
+         for (j = 0; j < NUM; j++)
+            nf_elem_map_insert(map, a + j, 0, nf);
+      }
+	   prof_stop();
+
+      nf_elem_map_clear(map, nf);
+
+      _nf_elem_vec_clear(a, NUM, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Insertion of number field elements into a hash map\n");
+   flint_printf("bits = %ld, elements = %ld\n", BITS, NUM);
+
+   for (k = 2; k <= 50; k = (slong) ceil(1.5*k))
+   {
+      info.length = k;
+      info.vec = 0;
+
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("insert    : length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+
+      info.vec = 1;
+     
+      prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("insert_vec: length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+   }
+
+   return 0;
+}
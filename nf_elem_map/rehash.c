@@ -0,0 +1,38 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_map.h"
+
+void _nf_elem_map_rehash(nf_elem_map_t map, slong size)
+{
+   const ulong mask = size - 1;
+   slong i;
+   ulong j;
+
+   flint_free(map->table);
+
+   map->table = (slong *) flint_malloc(size*sizeof(slong));
+   map->table_size = size;
+
+   for (i = 0; i < size; i++)
+      map->table[i] = -1;
+
+   /* the keys are distinct, so only an empty slot needs to be found */
+   for (i = 0; i < map->length; i++)
+   {
+      j = _nf_elem_map_slot(map->hashes[i], size);
+
+      while (map->table[j] != -1)
+         j = (j + 1) & mask;
+
+      map->table[j] = i;
+   }
+}
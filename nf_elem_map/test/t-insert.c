@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+#include "nf_elem_map.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("insert....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test repeated keys are only inserted once, in order of appearance */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_map_t map;
+        nf_elem_struct * a;
+        nf_elem_t b, c;
+        slong * idx;
+        slong len, num, count, j, k;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        nf_elem_init(c, nf);
+
+        len = n_randint(state, 200);
+        num = 1 + n_randint(state, 50);
+
+        a = _nf_elem_vec_init(len, nf);
+        idx = (slong *) flint_malloc(len*sizeof(slong));
+
+        /* draw from a small pool so that there are repeated entries */
+        _nf_elem_vec_randtest(a, state, FLINT_MIN(len, num), 10, nf);
+        for (j = num; j < len; j++)
+           nf_elem_set(a + j, a + n_randint(state, num), nf);
+
+        nf_elem_map_init(map, nf);
+
+        for (j = 0; j < len; j++)
+           idx[j] = nf_elem_map_insert(map, a + j, j, nf);
+
+        count = 0;
+        for (j = 0; j < len; j++)
+        {
+           /* first occurrence of a[j] */
+           for (k = 0; !nf_elem_equal(a + k, a + j, nf); k++) ;
+
+           if (k == j)
+              result = (idx[j] == count++);
+           else
+              result = (idx[j] == idx[k]);
+
+           nf_elem_map_get_key(c, map, idx[j], nf);
+           result = result && nf_elem_equal(c, a + j, nf);
+           result = result && (nf_elem_map_value(map, idx[j]) == k);
+           result = result && (nf_elem_map_find(map, a + j, nf) == idx[j]);
+
+           if (!result)
+           {
+              printf("FAIL:\n");
+              flint_printf("len = %wd, j = %wd, k = %wd\n", len, j, k);
+              flint_printf("idx[j] = %wd, idx[k] = %wd\n", idx[j], idx[k]);
+              abort();
+           }
+        }
+
+        nf_elem_init(b, nf);
+        nf_elem_randtest(b, state, 20, nf);
+
+        /* b is found if and only if it is one of the keys */
+        for (k = 0; k < len && !nf_elem_equal(a + k, b, nf); k++) ;
+
+        result = (nf_elem_map_length(map) == count);
+        result = result && ((k == len) == (nf_elem_map_find(map, b, nf) == -1));
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd, count = %wd, length = %wd, k = %wd\n",
+                                   len, count, nf_elem_map_length(map), k);
+           printf("b = "); nf_elem_print_pretty(b, nf, "x"); printf("\n");
+           abort();
+        }
+
+        nf_elem_clear(b, nf);
+        nf_elem_clear(c, nf);
+        nf_elem_map_clear(map, nf);
+        _nf_elem_vec_clear(a, len, nf);
+        flint_free(idx);
+
+        nf_clear(nf);
+    }
+
+    /* test keys whose fingerprints are multiples of a power of two spread */
+    for (i = 0; i < 10 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_map_t map;
+        nf_elem_t b;
+        slong len, j, k, shift, disp;
+        ulong mask;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        len = 1 + n_randint(state, 2000);
+        shift = 8 + n_randint(state, FLINT_BITS/2 - 12);
+
+        nf_elem_init(b, nf);
+        nf_elem_map_init(map, nf);
+
+        for (j = 0; j < len; j++)
+        {
+           nf_elem_set_si(b, j << shift, nf);
+           nf_elem_map_insert(map, b, j, nf);
+        }
+
+        mask = map->table_size - 1;
+
+        /* total distance of keys from their slots under linear probing */
+        disp = 0;
+        for (k = 0; k < map->table_size; k++)
+        {
+           j = map->table[k];
+           if (j != -1)
+              disp += (k - _nf_elem_map_slot(map->hashes[j], map->table_size)) & mask;
+        }
+
+        result = (nf_elem_map_length(map) == len) && (disp <= 4*len);
+
+        for (j = 0; j < len && result; j++)
+        {
+           nf_elem_set_si(b, j << shift, nf);
+           result = (nf_elem_map_find(map, b, nf) == j);
+        }
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd, shift = %wd, j = %wd, disp = %wd\n",
+                                                      len, shift, j, disp);
+           abort();
+        }
+
+        nf_elem_map_clear(map, nf);
+        nf_elem_clear(b, nf);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
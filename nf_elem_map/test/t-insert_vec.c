@@ -0,0 +1,101 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+#include "nf_elem_map.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("insert_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with inserting the keys one at a time */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_map_t map1, map2;
+        nf_elem_struct * a;
+        slong * idx1, * idx2, * idx3, * vals;
+        slong len, num, j;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        len = n_randint(state, 4000);
+        num = 1 + n_randint(state, 2000);
+
+        a = _nf_elem_vec_init(len, nf);
+        idx1 = (slong *) flint_malloc(len*sizeof(slong));
+        idx2 = (slong *) flint_malloc(len*sizeof(slong));
+        idx3 = (slong *) flint_malloc(len*sizeof(slong));
+        vals = (slong *) flint_malloc(len*sizeof(slong));
+
+        _nf_elem_vec_randtest(a, state, FLINT_MIN(len, num), 10, nf);
+        for (j = num; j < len; j++)
+           nf_elem_set(a + j, a + n_randint(state, num), nf);
+
+        for (j = 0; j < len; j++)
+           vals[j] = n_randint(state, 1000);
+
+        nf_elem_map_init(map1, nf);
+        nf_elem_map_init(map2, nf);
+
+        for (j = 0; j < len; j++)
+           idx1[j] = nf_elem_map_insert(map1, a + j, vals[j], nf);
+
+        /* the second half is inserted into a map which is not empty */
+        nf_elem_map_insert_vec(idx2, map2, a, vals, len/2, nf);
+        nf_elem_map_insert_vec(idx2 + len/2, map2, a + len/2, vals + len/2,
+                                                         len - len/2, nf);
+
+        nf_elem_map_find_vec(idx3, map1, a, len, nf);
+
+        result = (nf_elem_map_length(map1) == nf_elem_map_length(map2));
+
+        for (j = 0; j < len && result; j++)
+        {
+           result = (idx1[j] == idx2[j] && idx1[j] == idx3[j]
+              && nf_elem_map_value(map1, idx1[j]) == nf_elem_map_value(map2, idx2[j]));
+        }
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd, j = %wd\n", len, j);
+           abort();
+        }
+
+        nf_elem_map_clear(map1, nf);
+        nf_elem_map_clear(map2, nf);
+        _nf_elem_vec_clear(a, len, nf);
+        flint_free(idx1);
+        flint_free(idx2);
+        flint_free(idx3);
+        flint_free(vals);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
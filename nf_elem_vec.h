@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#ifndef NF_ELEM_VEC_H
+#define NF_ELEM_VEC_H
+
+#include "gmp.h"
+#include "flint/flint.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* minimum length of a dot product before it is split across threads */
+#define NF_ELEM_VEC_DOT_THREAD_CUTOFF 64
+
+/******************************************************************************
+
+    Memory management
+
+******************************************************************************/
+
+ANTIC_DLL nf_elem_struct * _nf_elem_vec_init(slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_clear(nf_elem_struct * vec,
+                                                   slong len, const nf_t nf);
+
+/******************************************************************************
+
+    Randomisation
+
+******************************************************************************/
+
+ANTIC_DLL void _nf_elem_vec_randtest(nf_elem_struct * vec, flint_rand_t state,
+                                   slong len, mp_bitcnt_t bits, const nf_t nf);
+
+/******************************************************************************
+
+    Assignment and basic manipulation
+
+******************************************************************************/
+
+ANTIC_DLL void _nf_elem_vec_set(nf_elem_struct * res,
+                         const nf_elem_struct * vec, slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_zero(nf_elem_struct * vec,
+                                                   slong len, const nf_t nf);
+
+/******************************************************************************
+
+    Comparison
+
+******************************************************************************/
+
+ANTIC_DLL int _nf_elem_vec_equal(const nf_elem_struct * vec1,
+                        const nf_elem_struct * vec2, slong len, const nf_t nf);
+
+/******************************************************************************
+
+    Arithmetic
+
+******************************************************************************/
+
+ANTIC_DLL void _nf_elem_vec_add(nf_elem_struct * res,
+                   const nf_elem_struct * vec1, const nf_elem_struct * vec2,
+                                                   slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_sub(nf_elem_struct * res,
+                   const nf_elem_struct * vec1, const nf_elem_struct * vec2,
+                                                   slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_scalar_mul(nf_elem_struct * res,
+                    const nf_elem_struct * vec, slong len, const nf_elem_t c,
+                                                               const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_dot_unreduced(nf_elem_t res,
+                   const nf_elem_struct * vec1, const nf_elem_struct * vec2,
+                                                   slong len, const nf_t nf);
+
+ANTIC_DLL void _nf_elem_vec_dot(nf_elem_t res, const nf_elem_struct * vec1,
+                     const nf_elem_struct * vec2, slong len, const nf_t nf);
+
+/******************************************************************************
+
+    Binary serialisation
+
+******************************************************************************/
+
+ANTIC_DLL int _nf_elem_vec_write_bin(nf_bin_stream_t s,
+                         const nf_elem_struct * vec, slong len, const nf_t nf);
+
+ANTIC_DLL int _nf_elem_vec_read_bin(nf_elem_struct ** vec, slong * len,
+                                        nf_bin_stream_t s, const nf_t nf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "flint/thread_support.h"
+#include "nf_elem_vec.h"
+
+typedef struct
+{
+   nf_elem_struct * res;
+   const nf_elem_struct * vec1;
+   const nf_elem_struct * vec2;
+   slong len;
+   const nf_struct * nf;
+} _dot_worker_arg_struct;
+
+static void
+_nf_elem_vec_dot_worker(void * varg)
+{
+   _dot_worker_arg_struct * arg = (_dot_worker_arg_struct *) varg;
+
+   _nf_elem_vec_dot_unreduced(arg->res, arg->vec1, arg->vec2,
+                                                          arg->len, arg->nf);
+}
+
+void _nf_elem_vec_dot(nf_elem_t res, const nf_elem_struct * vec1,
+                     const nf_elem_struct * vec2, slong len, const nf_t nf)
+{
+   thread_pool_handle * threads;
+   _dot_worker_arg_struct * args;
+   nf_elem_struct * sums;
+   slong i, start, num_threads, num_workers;
+
+   num_threads = FLINT_MIN(flint_get_num_threads(),
+                                      len/NF_ELEM_VEC_DOT_THREAD_CUTOFF);
+
+   if (num_threads <= 1)
+   {
+      _nf_elem_vec_dot_unreduced(res, vec1, vec2, len, nf);
+      nf_elem_reduce(res, nf);
+
+      return;
+   }
+
+   num_workers = flint_request_threads(&threads, num_threads);
+
+   /* each thread accumulates an unreduced partial sum of a block of terms */
+   sums = (nf_elem_struct *)
+            flint_malloc((num_workers + 1)*sizeof(nf_elem_struct));
+   args = (_dot_worker_arg_struct *)
+            flint_malloc((num_workers + 1)*sizeof(_dot_worker_arg_struct));
+
+   start = 0;
+   for (i = 0; i <= num_workers; i++)
+   {
+      slong end = ((i + 1)*len)/(num_workers + 1);
+
+      nf_elem_init(sums + i, nf);
+
+      args[i].res = sums + i;
+      args[i].vec1 = vec1 + start;
+      args[i].vec2 = vec2 + start;
+      args[i].len = end - start;
+      args[i].nf = nf;
+
+      start = end;
+   }
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wake(global_thread_pool, threads[i], 0,
+                                         _nf_elem_vec_dot_worker, &args[i]);
+
+   _nf_elem_vec_dot_worker(&args[num_workers]);
+
+   for (i = 0; i < num_workers; i++)
+      thread_pool_wait(global_thread_pool, threads[i]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   /* combine the partial sums, reduce and canonicalise only once */
+   nf_elem_swap(res, sums + num_workers, nf);
+
+   for (i = 0; i < num_workers; i++)
+      _nf_elem_add(res, res, sums + i, nf);
+
+   nf_elem_reduce(res, nf);
+
+   for (i = 0; i <= num_workers; i++)
+      nf_elem_clear(sums + i, nf);
+
+   flint_free(sums);
+   flint_free(args);
+}
@@ -0,0 +1,33 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_elem_vec.h"
+
+void _nf_elem_vec_dot_unreduced(nf_elem_t res, const nf_elem_struct * vec1,
+                    const nf_elem_struct * vec2, slong len, const nf_t nf)
+{
+   nf_elem_t t;
+   slong i;
+
+   nf_elem_zero(res, nf);
+
+   if (len <= 0)
+      return;
+
+   nf_elem_init(t, nf);
+
+   for (i = 0; i < len; i++)
+   {
+      _nf_elem_mul_red(t, vec1 + i, vec2 + i, nf, 0);
+      _nf_elem_add(res, res, t, nf);
+   }
+
+   nf_elem_clear(t, nf);
+}
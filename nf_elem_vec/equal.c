@@ -0,0 +1,29 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_vec.h"
+
+int _nf_elem_vec_equal(const nf_elem_struct * vec1,
+                         const nf_elem_struct * vec2, slong len, const nf_t nf)
+{
+   slong i;
+
+   if (vec1 == vec2)
+      return 1;
+
+   for (i = 0; i < len; i++)
+   {
+      if (!nf_elem_equal(vec1 + i, vec2 + i, nf))
+         return 0;
+   }
+
+   return 1;
+}
@@ -0,0 +1,25 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_vec.h"
+
+nf_elem_struct * _nf_elem_vec_init(slong len, const nf_t nf)
+{
+   nf_elem_struct * vec;
+   slong i;
+
+   vec = (nf_elem_struct *) flint_malloc(len*sizeof(nf_elem_struct));
+
+   for (i = 0; i < len; i++)
+      nf_elem_init(vec + i, nf);
+
+   return vec;
+}
@@ -0,0 +1,156 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+#define BITS 100
+
+#define NUM 100
+
+typedef struct
+{
+   slong length;
+   int dot;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_elem(nf_elem_t a, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+   slong i;
+
+   random_fmpq_poly(NF_ELEM(a), state, len);
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j;
+   int dot = info->dot;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_struct * a, * b;
+   nf_elem_t s, t;
+
+   fmpq_poly_init(pol);
+        
+   for (i = 0; i < count; i++)
+   {
+      random_fmpq_poly(pol, state, length);
+	
+      nf_init(nf, pol);
+
+      a = _nf_elem_vec_init(NUM, nf);
+      b = _nf_elem_vec_init(NUM, nf);
+      nf_elem_init(s, nf);
+      nf_elem_init(t, nf);
+       
+      for (j = 0; j < NUM; j++)
+      {
+         random_nf_elem(a + j, state, nf);
+         random_nf_elem(b + j, state, nf);
+      }
+	
+      prof_start();
+      if (dot)
+         _nf_elem_vec_dot(s, a, b, NUM, nf);
+      else
+      {
+         nf_elem_zero(s, nf);
+         for (j = 0; j < NUM; j++)
+         {
+            nf_elem_mul(t, a + j, b + j, nf);
+            nf_elem_add(s, s, t, nf);
+         }
+      }
+	   prof_stop();
+
+      _nf_elem_vec_clear(a, NUM, nf);
+      _nf_elem_vec_clear(b, NUM, nf);
+      nf_elem_clear(s, nf);
+      nf_elem_clear(t, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Dot product of vectors of number field elements\n");
+   flint_printf("bits = %ld, vector length = %ld\n", BITS, NUM);
+
+   for (k = 4; k <= 60; k = (slong) ceil(1.1*k))
+   {
+      info.length = k;
+      info.dot = 0;
+
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("mul/add: length %wd, min %.3e ms, max %.3e ms\n", 
+           info.length,
+		   (min/1000),
+           (max/1000)
+	     );
+
+      info.dot = 1;
+     
+      prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("dot    : length %wd, min %.3e ms, max %.3e ms\n", 
+           info.length,
+		   (min/1000),
+           (max/1000)
+	     );
+   }
+
+   return 0;
+}
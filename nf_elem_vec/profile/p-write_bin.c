@@ -0,0 +1,133 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+#define BITS 100
+
+#define NUM 10000
+
+typedef struct
+{
+   slong length;
+   int bin;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, i, j, size, len;
+   int bin = info->bin;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_elem_struct * a, * b;
+   nf_bin_stream_t s;
+   unsigned char * buf;
+   char * str;
+
+   fmpq_poly_init(pol);
+
+   for (i = 0; i < count; i++)
+   {
+      do {
+         fmpq_poly_randtest_not_zero(pol, state, length, BITS);
+      } while (pol->length != length);
+	
+      nf_init(nf, pol);
+       
+      a = _nf_elem_vec_init(NUM, nf);
+      _nf_elem_vec_randtest(a, state, NUM, BITS, nf);
+
+      nf_bin_stream_init_buf(s, NULL, 0);
+      _nf_elem_vec_write_bin(s, a, NUM, nf);
+      size = s->pos;
+
+      buf = (unsigned char *) flint_malloc(size);
+
+      /* write and read back, in binary or as decimal strings */
+      prof_start();
+      if (bin)
+      {
+         nf_bin_stream_init_buf(s, buf, size);
+         _nf_elem_vec_write_bin(s, a, NUM, nf);
+
+         nf_bin_stream_init_buf(s, buf, size);
+         _nf_elem_vec_read_bin(&b, &len, s, nf);
+         _nf_elem_vec_clear(b, len, nf);
+      } else
+      {
+         for (j = 0; j < NUM; j++)
+         {
+            str = nf_elem_get_str_pretty(a + j, "x", nf);
+            flint_free(str);
+         }
+      }
+	   prof_stop();
+
+      flint_free(buf);
+
+      _nf_elem_vec_clear(a, NUM, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Binary serialisation of number field elements\n");
+   flint_printf("bits = %ld, elements = %ld\n", BITS, NUM);
+
+   for (k = 2; k <= 50; k = (slong) ceil(1.5*k))
+   {
+      info.length = k;
+      info.bin = 0;
+
+      prof_repeat(&min, &max, sample, (void *) &info);
+      
+      flint_printf("get_str (write only) : length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+
+      info.bin = 1;
+     
+      prof_repeat(&min, &max, sample, (void *) &info);
+         
+      flint_printf("binary (write + read): length %wd, min %.3e us, max %.3e us\n", 
+           info.length,
+		   (min/NUM),
+           (max/NUM)
+	     );
+   }
+
+   return 0;
+}
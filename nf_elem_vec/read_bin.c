@@ -0,0 +1,76 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <string.h>
+#include "nf_elem_vec.h"
+
+int _nf_elem_vec_read_bin(nf_elem_struct ** vec, slong * len,
+                                        nf_bin_stream_t s, const nf_t nf)
+{
+   unsigned char magic[8];
+   ulong version, h, n;
+   nf_elem_struct * v;
+   fmpz_t den;
+   slong i, j, alloc;
+
+   if (!_nf_bin_read(magic, s, 8) || !_nf_bin_read_ui(&version, s)
+    || !_nf_bin_read_ui(&h, s) || !_nf_bin_read_ui(&n, s))
+      return 0;
+
+   /* the elements must belong to this number field */
+   if (memcmp(magic, NF_BIN_MAGIC_VEC, 8) != 0 || version > NF_BIN_VERSION
+    || h != nf_hash(nf) || n > WORD_MAX/16
+    || (s->file == NULL && 8*n > s->size - s->pos))
+   {
+      s->error = 1;
+      return 0;
+   }
+
+   fmpz_init(den);
+
+   if (!_nf_bin_read_fmpz(den, s))
+   {
+      fmpz_clear(den);
+      return 0;
+   }
+
+   /* as for integers, only allocate entries as they are read */
+   alloc = FLINT_MIN(n, NF_BIN_CHUNK/8);
+   v = _nf_elem_vec_init(alloc, nf);
+
+   for (i = 0; i < n; i++)
+   {
+      if (i == alloc)
+      {
+         alloc = FLINT_MIN(n, 2*alloc);
+         v = (nf_elem_struct *) flint_realloc(v, alloc*sizeof(nf_elem_struct));
+
+         for (j = i; j < alloc; j++)
+            nf_elem_init(v + j, nf);
+      }
+
+      if (!_nf_elem_read_bin(v + i, s, den, nf))
+         break;
+   }
+
+   fmpz_clear(den);
+
+   if (s->error)
+   {
+      _nf_elem_vec_clear(v, alloc, nf);
+      return 0;
+   }
+
+   *vec = v;
+   *len = n;
+
+   return 1;
+}
@@ -0,0 +1,24 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_vec.h"
+
+void _nf_elem_vec_set(nf_elem_struct * res, const nf_elem_struct * vec,
+                                                      slong len, const nf_t nf)
+{
+   slong i;
+
+   if (res != vec)
+   {
+      for (i = 0; i < len; i++)
+         nf_elem_set(res + i, vec + i, nf);
+   }
+}
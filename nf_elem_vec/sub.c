@@ -0,0 +1,21 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_vec.h"
+
+void _nf_elem_vec_sub(nf_elem_struct * res, const nf_elem_struct * vec1,
+                    const nf_elem_struct * vec2, slong len, const nf_t nf)
+{
+   slong i;
+
+   for (i = 0; i < len; i++)
+      nf_elem_sub(res + i, vec1 + i, vec2 + i, nf);
+}
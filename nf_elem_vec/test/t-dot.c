@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against a sum of products computed with nf_elem_mul */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        nf_elem_t d, s, p;
+        slong j, len;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        len = n_randint(state, 4*NF_ELEM_VEC_DOT_THREAD_CUTOFF);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        nf_elem_init(d, nf);
+        nf_elem_init(s, nf);
+        nf_elem_init(p, nf);
+
+        _nf_elem_vec_randtest(a, state, len, 100, nf);
+        _nf_elem_vec_randtest(b, state, len, 100, nf);
+
+        _nf_elem_vec_dot(d, a, b, len, nf);
+
+        nf_elem_zero(s, nf);
+        for (j = 0; j < len; j++)
+        {
+            nf_elem_mul(p, a + j, b + j, nf);
+            nf_elem_add(s, s, p, nf);
+        }
+
+        result = (nf_elem_equal(d, s, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd\n", len);
+           printf("d = "); nf_elem_print_pretty(d, nf, "x"); printf("\n");
+           printf("s = "); nf_elem_print_pretty(s, nf, "x"); printf("\n");
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        nf_elem_clear(d, nf);
+        nf_elem_clear(s, nf);
+        nf_elem_clear(p, nf);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing vec1 and vec2 */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        nf_elem_t d1, d2;
+        slong len;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        len = n_randint(state, 4*NF_ELEM_VEC_DOT_THREAD_CUTOFF);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        nf_elem_init(d1, nf);
+        nf_elem_init(d2, nf);
+
+        _nf_elem_vec_randtest(a, state, len, 100, nf);
+        _nf_elem_vec_set(b, a, len, nf);
+
+        _nf_elem_vec_dot(d1, a, b, len, nf);
+        _nf_elem_vec_dot(d2, a, a, len, nf);
+
+        result = (nf_elem_equal(d1, d2, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd\n", len);
+           printf("d1 = "); nf_elem_print_pretty(d1, nf, "x"); printf("\n");
+           printf("d2 = "); nf_elem_print_pretty(d2, nf, "x"); printf("\n");
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        nf_elem_clear(d1, nf);
+        nf_elem_clear(d2, nf);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("scalar_mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against nf_elem_mul */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        nf_elem_t c, p;
+        slong j, len;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        nf_elem_init(c, nf);
+        nf_elem_init(p, nf);
+
+        _nf_elem_vec_randtest(b, state, len, 200, nf);
+        nf_elem_randtest(c, state, 200, nf);
+
+        _nf_elem_vec_scalar_mul(a, b, len, c, nf);
+
+        for (j = 0; j < len; j++)
+        {
+            nf_elem_mul(p, b + j, c, nf);
+
+            result = (nf_elem_equal(a + j, p, nf));
+            if (!result)
+            {
+               printf("FAIL:\n");
+               flint_printf("len = %wd, j = %wd\n", len, j);
+               printf("a = "); nf_elem_print_pretty(a + j, nf, "x"); printf("\n");
+               printf("b = "); nf_elem_print_pretty(b + j, nf, "x"); printf("\n");
+               printf("c = "); nf_elem_print_pretty(c, nf, "x"); printf("\n");
+               printf("p = "); nf_elem_print_pretty(p, nf, "x"); printf("\n");
+               abort();
+            }
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        nf_elem_clear(c, nf);
+        nf_elem_clear(p, nf);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing res and vec */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        nf_elem_t c;
+        slong len;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        nf_elem_init(c, nf);
+
+        _nf_elem_vec_randtest(b, state, len, 200, nf);
+        nf_elem_randtest(c, state, 200, nf);
+
+        _nf_elem_vec_scalar_mul(a, b, len, c, nf);
+        _nf_elem_vec_scalar_mul(b, b, len, c, nf);
+
+        result = (_nf_elem_vec_equal(a, b, len, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd\n", len);
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        nf_elem_clear(c, nf);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
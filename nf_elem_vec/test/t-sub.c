@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("sub....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test (a - b) + b = a */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b, * c;
+        slong len;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        c = _nf_elem_vec_init(len, nf);
+
+        _nf_elem_vec_randtest(a, state, len, 200, nf);
+        _nf_elem_vec_randtest(b, state, len, 200, nf);
+
+        _nf_elem_vec_sub(c, a, b, len, nf);
+        _nf_elem_vec_add(c, c, b, len, nf);
+
+        result = (_nf_elem_vec_equal(a, c, len, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd\n", len);
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        _nf_elem_vec_clear(c, len, nf);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing res and vec2 */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b, * c;
+        slong len;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        b = _nf_elem_vec_init(len, nf);
+        c = _nf_elem_vec_init(len, nf);
+
+        _nf_elem_vec_randtest(a, state, len, 200, nf);
+        _nf_elem_vec_randtest(b, state, len, 200, nf);
+
+        _nf_elem_vec_sub(c, a, b, len, nf);
+        _nf_elem_vec_sub(b, a, b, len, nf);
+
+        result = (_nf_elem_vec_equal(b, c, len, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("len = %wd\n", len);
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        _nf_elem_vec_clear(c, len, nf);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
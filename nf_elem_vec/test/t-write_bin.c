@@ -0,0 +1,207 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_elem_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("write_bin....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test reading back a vector, from a file and from a buffer */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b, * c;
+        nf_bin_stream_t s;
+        unsigned char * buf;
+        slong len, blen, clen, size, j;
+        FILE * file;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        _nf_elem_vec_randtest(a, state, len, 200, nf);
+
+        /* sometimes make all entries integral, sharing the denominator 1 */
+        if (n_randint(state, 2))
+        {
+           fmpz_t d;
+           fmpz_init(d);
+
+           for (j = 0; j < len; j++)
+           {
+              nf_elem_get_den(d, a + j, nf);
+              nf_elem_scalar_mul_fmpz(a + j, a + j, d, nf);
+           }
+
+           fmpz_clear(d);
+        }
+
+        file = tmpfile();
+
+        nf_bin_stream_init_file(s, file);
+        result = _nf_elem_vec_write_bin(s, a, len, nf);
+        size = s->pos;
+
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        result = result && _nf_elem_vec_read_bin(&b, &blen, s, nf);
+
+        /* the same bytes go to a buffer */
+        buf = (unsigned char *) flint_malloc(size);
+
+        rewind(file);
+        result = result && fread(buf, 1, size, file) == (size_t) size;
+
+        fclose(file);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = result && _nf_elem_vec_read_bin(&c, &clen, s, nf);
+
+        result = result && blen == len && clen == len
+                        && _nf_elem_vec_equal(a, b, len, nf)
+                        && _nf_elem_vec_equal(a, c, len, nf);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           flint_printf("len = %wd, size = %wd\n", len, size);
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+        _nf_elem_vec_clear(b, len, nf);
+        _nf_elem_vec_clear(c, len, nf);
+        flint_free(buf);
+
+        nf_clear(nf);
+    }
+
+    /* test a vector cannot be read in a different number field */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf1, nf2;
+        nf_elem_struct * a, * b;
+        nf_bin_stream_t s;
+        unsigned char * buf;
+        slong len, blen, size;
+
+        nf_init_randtest(nf1, state, 40, 200);
+
+        do {
+           nf_init_randtest(nf2, state, 40, 200);
+           if (nf1->pol->length == nf2->pol->length
+                         && !fmpq_poly_equal(nf1->pol, nf2->pol))
+              break;
+           nf_clear(nf2);
+        } while (1);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf1);
+        _nf_elem_vec_randtest(a, state, len, 200, nf1);
+
+        nf_bin_stream_init_buf(s, NULL, 0);
+        _nf_elem_vec_write_bin(s, a, len, nf1);
+        size = s->pos;
+
+        buf = (unsigned char *) flint_malloc(size);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        _nf_elem_vec_write_bin(s, a, len, nf1);
+
+        nf_bin_stream_init_buf(s, buf, size);
+        result = !_nf_elem_vec_read_bin(&b, &blen, s, nf2);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K1 = "); nf_print(nf1); printf("\n");
+           printf("K2 = "); nf_print(nf2); printf("\n");
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf1);
+        flint_free(buf);
+
+        nf_clear(nf1);
+        nf_clear(nf2);
+    }
+
+    /* test a length beyond the end of a file is rejected */
+    for (i = 0; i < 10 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_elem_struct * a, * b;
+        nf_bin_stream_t s;
+        slong len, blen;
+        FILE * file;
+
+        nf_init_randtest(nf, state, 40, 200);
+
+        len = n_randint(state, 20);
+
+        a = _nf_elem_vec_init(len, nf);
+        _nf_elem_vec_randtest(a, state, len, 200, nf);
+
+        file = tmpfile();
+
+        nf_bin_stream_init_file(s, file);
+        result = _nf_elem_vec_write_bin(s, a, len, nf);
+
+        /* overwrite the length in the header */
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        _nf_bin_write(s, (const unsigned char *) NF_BIN_MAGIC_VEC, 8);
+        _nf_bin_write_ui(s, NF_BIN_VERSION);
+        _nf_bin_write_ui(s, nf_hash(nf));
+        _nf_bin_write_ui(s, len + 1 + n_randint(state, WORD_MAX/16 - len));
+
+        rewind(file);
+
+        nf_bin_stream_init_file(s, file);
+        result = result && !_nf_elem_vec_read_bin(&b, &blen, s, nf);
+
+        fclose(file);
+
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("K = "); nf_print(nf); printf("\n");
+           flint_printf("len = %wd\n", len);
+           abort();
+        }
+
+        _nf_elem_vec_clear(a, len, nf);
+
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
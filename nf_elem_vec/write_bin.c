@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "nf_elem_vec.h"
+
+/*
+   A vector is written as a header consisting of a tag, the version of the
+   format, the fingerprint of the number field, the length and a shared
+   denominator, followed by the elements. Elements whose denominator is the
+   shared one do not repeat it.
+*/
+int _nf_elem_vec_write_bin(nf_bin_stream_t s, const nf_elem_struct * vec,
+                                                   slong len, const nf_t nf)
+{
+   fmpz_t den;
+   slong i;
+
+   fmpz_init_set_ui(den, 1);
+
+   /* use the denominator of the first element */
+   if (len > 0)
+   {
+      if (nf->flag & NF_LINEAR)
+         fmpz_set(den, LNF_ELEM_DENREF(vec));
+      else if (nf->flag & NF_QUADRATIC)
+         fmpz_set(den, QNF_ELEM_DENREF(vec));
+      else
+         fmpz_set(den, NF_ELEM_DENREF(vec));
+   }
+
+   _nf_bin_write(s, (const unsigned char *) NF_BIN_MAGIC_VEC, 8);
+   _nf_bin_write_ui(s, NF_BIN_VERSION);
+   _nf_bin_write_ui(s, nf_hash(nf));
+   _nf_bin_write_ui(s, len);
+   _nf_bin_write_fmpz(s, den);
+
+   for (i = 0; i < len && !s->error; i++)
+      _nf_elem_write_bin(s, vec + i, den, nf);
+
+   fmpz_clear(den);
+
+   return !s->error;
+}
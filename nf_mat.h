@@ -0,0 +1,105 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#ifndef NF_MAT_H
+#define NF_MAT_H
+
+#ifdef NF_MAT_INLINES_C
+#define NF_MAT_INLINE ANTIC_DLL
+#else
+#define NF_MAT_INLINE static __inline__
+#endif
+
+#include "gmp.h"
+#include "flint/flint.h"
+#include "nf.h"
+#include "nf_elem.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+typedef struct /* dense matrix over a number field */
+{
+   nf_elem_struct * entries;
+   slong r;
+   slong c;
+   nf_elem_struct ** rows;
+} nf_mat_struct;
+
+typedef nf_mat_struct nf_mat_t[1];
+
+#define nf_mat_entry(mat, i, j) ((mat)->rows[i] + (j))
+
+NF_MAT_INLINE
+slong nf_mat_nrows(const nf_mat_t mat)
+{
+   return mat->r;
+}
+
+NF_MAT_INLINE
+slong nf_mat_ncols(const nf_mat_t mat)
+{
+   return mat->c;
+}
+
+/******************************************************************************
+
+    Initialisation
+
+******************************************************************************/
+
+ANTIC_DLL void nf_mat_init(nf_mat_t mat, slong rows, slong cols, const nf_t nf);
+
+ANTIC_DLL void nf_mat_clear(nf_mat_t mat, const nf_t nf);
+
+ANTIC_DLL void nf_mat_randtest(nf_mat_t mat, flint_rand_t state,
+                                             mp_bitcnt_t bits, const nf_t nf);
+
+/******************************************************************************
+
+    Basic manipulation
+
+******************************************************************************/
+
+ANTIC_DLL void nf_mat_set(nf_mat_t res, const nf_mat_t mat, const nf_t nf);
+
+ANTIC_DLL void nf_mat_swap(nf_mat_t mat1, nf_mat_t mat2, const nf_t nf);
+
+ANTIC_DLL void nf_mat_zero(nf_mat_t mat, const nf_t nf);
+
+ANTIC_DLL void nf_mat_one(nf_mat_t mat, const nf_t nf);
+
+/******************************************************************************
+
+    Comparison
+
+******************************************************************************/
+
+ANTIC_DLL int nf_mat_equal(const nf_mat_t mat1,
+                                       const nf_mat_t mat2, const nf_t nf);
+
+/******************************************************************************
+
+    Multiplication
+
+******************************************************************************/
+
+ANTIC_DLL void nf_mat_mul_classical(nf_mat_t C, const nf_mat_t A,
+                                            const nf_mat_t B, const nf_t nf);
+
+ANTIC_DLL void nf_mat_mul(nf_mat_t C, const nf_mat_t A,
+                                            const nf_mat_t B, const nf_t nf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
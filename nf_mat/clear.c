@@ -0,0 +1,27 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+void nf_mat_clear(nf_mat_t mat, const nf_t nf)
+{
+   slong i;
+
+   if (mat->entries != NULL)
+   {
+      for (i = 0; i < mat->r*mat->c; i++)
+         nf_elem_clear(mat->entries + i, nf);
+
+      flint_free(mat->entries);
+   }
+
+   if (mat->rows != NULL)
+      flint_free(mat->rows);
+}
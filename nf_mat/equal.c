@@ -0,0 +1,31 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+int nf_mat_equal(const nf_mat_t mat1, const nf_mat_t mat2, const nf_t nf)
+{
+   slong i, j;
+
+   if (mat1->r != mat2->r || mat1->c != mat2->c)
+      return 0;
+
+   for (i = 0; i < mat1->r; i++)
+   {
+      for (j = 0; j < mat1->c; j++)
+      {
+         if (!nf_elem_equal(nf_mat_entry(mat1, i, j),
+                            nf_mat_entry(mat2, i, j), nf))
+            return 0;
+      }
+   }
+
+   return 1;
+}
@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+void nf_mat_init(nf_mat_t mat, slong rows, slong cols, const nf_t nf)
+{
+   slong i;
+
+   if (rows != 0 && cols != 0)
+   {
+      mat->entries = (nf_elem_struct *)
+                        flint_malloc(rows*cols*sizeof(nf_elem_struct));
+      mat->rows = (nf_elem_struct **)
+                        flint_malloc(rows*sizeof(nf_elem_struct *));
+
+      for (i = 0; i < rows*cols; i++)
+         nf_elem_init(mat->entries + i, nf);
+
+      for (i = 0; i < rows; i++)
+         mat->rows[i] = mat->entries + i*cols;
+   } else
+   {
+      mat->entries = NULL;
+
+      if (rows != 0)
+      {
+         mat->rows = (nf_elem_struct **)
+                        flint_malloc(rows*sizeof(nf_elem_struct *));
+
+         for (i = 0; i < rows; i++)
+            mat->rows[i] = NULL;
+      } else
+         mat->rows = NULL;
+   }
+
+   mat->r = rows;
+   mat->c = cols;
+}
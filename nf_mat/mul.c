@@ -0,0 +1,276 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "flint/fmpz_vec.h"
+#include "flint/fmpz_mat.h"
+#include "flint/fmpz_poly_mat.h"
+#include "nf_mat.h"
+
+static const fmpz *
+_nf_elem_denref(const nf_elem_t a, const nf_t nf)
+{
+   if (nf->flag & NF_LINEAR)
+      return LNF_ELEM_DENREF(a);
+   else if (nf->flag & NF_QUADRATIC)
+      return QNF_ELEM_DENREF(a);
+   else
+      return NF_ELEM_DENREF(a);
+}
+
+/*
+   Set rden[i] to the lcm of the denominators of row i of A and cden[j] to
+   the lcm of the denominators of column j of B.
+*/
+static void
+_nf_mat_mul_dens(fmpz * rden, fmpz * cden,
+                     const nf_mat_t A, const nf_mat_t B, const nf_t nf)
+{
+   const fmpz * den;
+   slong i, j;
+
+   for (i = 0; i < A->r; i++)
+   {
+      fmpz_one(rden + i);
+
+      for (j = 0; j < A->c; j++)
+      {
+         den = _nf_elem_denref(nf_mat_entry(A, i, j), nf);
+
+         if (!fmpz_is_one(den))
+            fmpz_lcm(rden + i, rden + i, den);
+      }
+   }
+
+   for (j = 0; j < B->c; j++)
+   {
+      fmpz_one(cden + j);
+
+      for (i = 0; i < B->r; i++)
+      {
+         den = _nf_elem_denref(nf_mat_entry(B, i, j), nf);
+
+         if (!fmpz_is_one(den))
+            fmpz_lcm(cden + j, cden + j, den);
+      }
+   }
+}
+
+/* set p to num(a)*d/den(a), where den(a) divides d */
+static void
+_nf_mat_entry_get_fmpz_poly(fmpz_poly_t p, fmpz_t t,
+                               const nf_elem_t a, const fmpz_t d, const nf_t nf)
+{
+   const fmpz * num;
+   slong len;
+
+   if (nf->flag & NF_QUADRATIC)
+   {
+      num = QNF_ELEM_NUMREF(a);
+      len = 2;
+   } else
+   {
+      num = NF_ELEM_NUMREF(a);
+      len = NF_ELEM(a)->length;
+   }
+
+   fmpz_divexact(t, d, _nf_elem_denref(a, nf));
+
+   fmpz_poly_fit_length(p, len);
+   _fmpz_vec_scalar_mul_fmpz(p->coeffs, num, len, t);
+   _fmpz_poly_set_length(p, len);
+   _fmpz_poly_normalise(p);
+}
+
+/* set a to p/d, reduce and canonicalise */
+static void
+_nf_mat_entry_set_fmpz_poly(nf_elem_t a, fmpz_poly_t p,
+                                              const fmpz_t d, const nf_t nf)
+{
+   if (nf->flag & NF_QUADRATIC)
+   {
+      fmpz * const anum = QNF_ELEM_NUMREF(a);
+      slong i;
+
+      /* the product has length at most 3, the extra coefficient is reduced */
+      for (i = 0; i < 3; i++)
+      {
+         if (i < p->length)
+            fmpz_swap(anum + i, p->coeffs + i);
+         else
+            fmpz_zero(anum + i);
+      }
+
+      fmpz_set(QNF_ELEM_DENREF(a), d);
+   } else
+   {
+      fmpq_poly_fit_length(NF_ELEM(a), p->length);
+      _fmpz_vec_swap(NF_ELEM_NUMREF(a), p->coeffs, p->length);
+      fmpz_set(NF_ELEM_DENREF(a), d);
+      _fmpq_poly_set_length(NF_ELEM(a), p->length);
+   }
+
+   nf_elem_reduce(a, nf);
+}
+
+static void
+_nf_mat_mul_linear(nf_mat_t C, const nf_mat_t A,
+                                            const nf_mat_t B, const nf_t nf)
+{
+   slong ar = A->r, br = B->r, bc = B->c, i, j;
+   fmpz_mat_t AZ, BZ, CZ;
+   fmpz * rden, * cden;
+   fmpz_t t;
+
+   fmpz_mat_init(AZ, ar, br);
+   fmpz_mat_init(BZ, br, bc);
+   fmpz_mat_init(CZ, ar, bc);
+   rden = _fmpz_vec_init(ar);
+   cden = _fmpz_vec_init(bc);
+   fmpz_init(t);
+
+   _nf_mat_mul_dens(rden, cden, A, B, nf);
+
+   for (i = 0; i < ar; i++)
+   {
+      for (j = 0; j < br; j++)
+      {
+         fmpz_divexact(t, rden + i, LNF_ELEM_DENREF(nf_mat_entry(A, i, j)));
+         fmpz_mul(fmpz_mat_entry(AZ, i, j),
+                  LNF_ELEM_NUMREF(nf_mat_entry(A, i, j)), t);
+      }
+   }
+
+   for (i = 0; i < br; i++)
+   {
+      for (j = 0; j < bc; j++)
+      {
+         fmpz_divexact(t, cden + j, LNF_ELEM_DENREF(nf_mat_entry(B, i, j)));
+         fmpz_mul(fmpz_mat_entry(BZ, i, j),
+                  LNF_ELEM_NUMREF(nf_mat_entry(B, i, j)), t);
+      }
+   }
+
+   fmpz_mat_mul(CZ, AZ, BZ);
+
+   for (i = 0; i < ar; i++)
+   {
+      for (j = 0; j < bc; j++)
+      {
+         nf_elem_struct * c = nf_mat_entry(C, i, j);
+
+         fmpz_swap(LNF_ELEM_NUMREF(c), fmpz_mat_entry(CZ, i, j));
+         fmpz_mul(LNF_ELEM_DENREF(c), rden + i, cden + j);
+         _fmpq_canonicalise(LNF_ELEM_NUMREF(c), LNF_ELEM_DENREF(c));
+      }
+   }
+
+   fmpz_mat_clear(AZ);
+   fmpz_mat_clear(BZ);
+   fmpz_mat_clear(CZ);
+   _fmpz_vec_clear(rden, ar);
+   _fmpz_vec_clear(cden, bc);
+   fmpz_clear(t);
+}
+
+void nf_mat_mul(nf_mat_t C, const nf_mat_t A,
+                                            const nf_mat_t B, const nf_t nf)
+{
+   slong ar, br, bc, i, j;
+   fmpz_poly_mat_t AZ, BZ, CZ;
+   fmpz * rden, * cden;
+   fmpz_t t;
+
+   ar = A->r;
+   br = B->r;
+   bc = B->c;
+
+   if (A->c != br || C->r != ar || C->c != bc)
+   {
+      flint_printf("Exception (nf_mat_mul). Incompatible dimensions.\n");
+      abort();
+   }
+
+   if (C == A || C == B)
+   {
+      nf_mat_t T;
+
+      nf_mat_init(T, ar, bc, nf);
+      nf_mat_mul(T, A, B, nf);
+      nf_mat_swap(C, T, nf);
+      nf_mat_clear(T, nf);
+
+      return;
+   }
+
+   if (ar == 0 || bc == 0)
+      return;
+
+   if (br == 0)
+   {
+      nf_mat_zero(C, nf);
+
+      return;
+   }
+
+   if (nf->flag & NF_LINEAR)
+   {
+      _nf_mat_mul_linear(C, A, B, nf);
+
+      return;
+   }
+
+   /*
+      Write A = D_A^{-1} A' and B = B' D_B^{-1} where D_A is the diagonal
+      matrix of row denominators of A and D_B that of the column denominators
+      of B. The product A'B' of integer polynomial matrices is computed in
+      one go and each entry is reduced once at the end.
+   */
+   fmpz_poly_mat_init(AZ, ar, br);
+   fmpz_poly_mat_init(BZ, br, bc);
+   fmpz_poly_mat_init(CZ, ar, bc);
+   rden = _fmpz_vec_init(ar);
+   cden = _fmpz_vec_init(bc);
+   fmpz_init(t);
+
+   _nf_mat_mul_dens(rden, cden, A, B, nf);
+
+   for (i = 0; i < ar; i++)
+   {
+      for (j = 0; j < br; j++)
+         _nf_mat_entry_get_fmpz_poly(fmpz_poly_mat_entry(AZ, i, j), t,
+                                     nf_mat_entry(A, i, j), rden + i, nf);
+   }
+
+   for (i = 0; i < br; i++)
+   {
+      for (j = 0; j < bc; j++)
+         _nf_mat_entry_get_fmpz_poly(fmpz_poly_mat_entry(BZ, i, j), t,
+                                     nf_mat_entry(B, i, j), cden + j, nf);
+   }
+
+   fmpz_poly_mat_mul(CZ, AZ, BZ);
+
+   for (i = 0; i < ar; i++)
+   {
+      for (j = 0; j < bc; j++)
+      {
+         fmpz_mul(t, rden + i, cden + j);
+         _nf_mat_entry_set_fmpz_poly(nf_mat_entry(C, i, j),
+                                  fmpz_poly_mat_entry(CZ, i, j), t, nf);
+      }
+   }
+
+   fmpz_poly_mat_clear(AZ);
+   fmpz_poly_mat_clear(BZ);
+   fmpz_poly_mat_clear(CZ);
+   _fmpz_vec_clear(rden, ar);
+   _fmpz_vec_clear(cden, bc);
+   fmpz_clear(t);
+}
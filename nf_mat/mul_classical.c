@@ -0,0 +1,64 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+void nf_mat_mul_classical(nf_mat_t C, const nf_mat_t A,
+                                            const nf_mat_t B, const nf_t nf)
+{
+   slong ar, bc, br, i, j, k;
+   nf_elem_t t;
+
+   ar = A->r;
+   br = B->r;
+   bc = B->c;
+
+   if (A->c != br || C->r != ar || C->c != bc)
+   {
+      flint_printf("Exception (nf_mat_mul_classical). Incompatible dimensions.\n");
+      abort();
+   }
+
+   if (C == A || C == B)
+   {
+      nf_mat_t T;
+
+      nf_mat_init(T, ar, bc, nf);
+      nf_mat_mul_classical(T, A, B, nf);
+      nf_mat_swap(C, T, nf);
+      nf_mat_clear(T, nf);
+
+      return;
+   }
+
+   nf_elem_init(t, nf);
+
+   for (i = 0; i < ar; i++)
+   {
+      for (j = 0; j < bc; j++)
+      {
+         nf_elem_struct * c = nf_mat_entry(C, i, j);
+
+         /* accumulate unreduced products, reduce once per entry */
+         nf_elem_zero(c, nf);
+
+         for (k = 0; k < br; k++)
+         {
+            _nf_elem_mul_red(t, nf_mat_entry(A, i, k),
+                                nf_mat_entry(B, k, j), nf, 0);
+            _nf_elem_add(c, c, t, nf);
+         }
+
+         nf_elem_reduce(c, nf);
+      }
+   }
+
+   nf_elem_clear(t, nf);
+}
@@ -0,0 +1,170 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_mat.h"
+
+#define BITS 10
+
+typedef struct
+{
+   slong length;
+   slong size;
+   int classical;
+} info_t;
+
+void random_fmpq_poly(fmpq_poly_t pol, flint_rand_t state, slong length)
+{
+   fmpz * arr;
+   slong i;
+
+   fmpq_poly_fit_length(pol, length);
+
+   arr = fmpq_poly_numref(pol);
+
+   for (i = 0; i < length; i++)
+      fmpz_randbits(arr + i, state, BITS);
+
+   fmpz_randbits(fmpq_poly_denref(pol), state, BITS);
+
+   _fmpq_poly_set_length(pol, length);
+   _fmpq_poly_normalise(pol);
+   fmpq_poly_canonicalise(pol);
+}
+
+void random_nf_mat(nf_mat_t A, flint_rand_t state, nf_t nf)
+{
+   slong len = nf->pol->length - 1;
+   slong i, j;
+
+   for (i = 0; i < nf_mat_nrows(A); i++)
+   {
+      for (j = 0; j < nf_mat_ncols(A); j++)
+      {
+         nf_elem_struct * a = nf_mat_entry(A, i, j);
+
+         if (nf->flag & NF_LINEAR)
+         {
+            fmpz_randbits(LNF_ELEM_NUMREF(a), state, BITS);
+            fmpz_randbits(LNF_ELEM_DENREF(a), state, BITS);
+            fmpz_abs(LNF_ELEM_DENREF(a), LNF_ELEM_DENREF(a));
+            fmpz_add_ui(LNF_ELEM_DENREF(a), LNF_ELEM_DENREF(a), 1);
+         } else if (nf->flag & NF_QUADRATIC)
+         {
+            fmpz_randbits(QNF_ELEM_NUMREF(a), state, BITS);
+            fmpz_randbits(QNF_ELEM_NUMREF(a) + 1, state, BITS);
+            fmpz_randbits(QNF_ELEM_DENREF(a), state, BITS);
+            fmpz_abs(QNF_ELEM_DENREF(a), QNF_ELEM_DENREF(a));
+            fmpz_add_ui(QNF_ELEM_DENREF(a), QNF_ELEM_DENREF(a), 1);
+         } else
+            random_fmpq_poly(NF_ELEM(a), state, len);
+
+         nf_elem_canonicalise(a, nf);
+      }
+   }
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong length = info->length, size = info->size, i;
+   int classical = info->classical;
+   
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpq_poly_t pol;
+   nf_t nf;
+   nf_mat_t A, B, C;
+
+   fmpq_poly_init(pol);
+        
+   for (i = 0; i < count; i++)
+   {
+      do {
+         random_fmpq_poly(pol, state, length);
+      } while (fmpq_poly_length(pol) != length);
+	
+      nf_init(nf, pol);
+       
+      nf_mat_init(A, size, size, nf);
+      nf_mat_init(B, size, size, nf);
+      nf_mat_init(C, size, size, nf);
+        
+      random_nf_mat(A, state, nf);
+      random_nf_mat(B, state, nf);
+	
+      prof_start();
+      if (classical)
+         nf_mat_mul_classical(C, A, B, nf);
+      else
+         nf_mat_mul(C, A, B, nf);
+	   prof_stop();
+
+      nf_mat_clear(A, nf);
+      nf_mat_clear(B, nf);
+      nf_mat_clear(C, nf);
+        
+      nf_clear(nf);
+   }
+  
+   fmpq_poly_clear(pol);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k, n;
+
+   printf("Matrix multiplication over number fields\n");
+   flint_printf("bits = %ld\n", BITS);
+
+   for (k = 2; k <= 16; k *= 2)
+   {
+      for (n = 10; n <= 200; n = (n == 10 ? 20 : (n == 20 ? 50 : 2*n)))
+      {
+         info.length = k + 1;
+         info.size = n;
+
+         /* the classical algorithm is too slow for the largest sizes */
+         if (n <= 50)
+         {
+            info.classical = 1;
+
+            prof_repeat(&min, &max, sample, (void *) &info);
+      
+            flint_printf("classical: degree %wd, size %wd, min %.3e ms, max %.3e ms\n", 
+                 k, n, (min/1000), (max/1000));
+         }
+
+         info.classical = 0;
+     
+         prof_repeat(&min, &max, sample, (void *) &info);
+         
+         flint_printf("mul      : degree %wd, size %wd, min %.3e ms, max %.3e ms\n", 
+              k, n, (min/1000), (max/1000));
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,21 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+void nf_mat_swap(nf_mat_t mat1, nf_mat_t mat2, const nf_t nf)
+{
+   if (mat1 != mat2)
+   {
+      nf_mat_struct t = *mat1;
+      *mat1 = *mat2;
+      *mat2 = t;
+   }
+}
@@ -0,0 +1,145 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_mat.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against nf_mat_mul_classical */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_mat_t A, B, C, D;
+        slong m, n, k;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+        k = n_randint(state, 10);
+
+        nf_mat_init(A, m, k, nf);
+        nf_mat_init(B, k, n, nf);
+        nf_mat_init(C, m, n, nf);
+        nf_mat_init(D, m, n, nf);
+
+        nf_mat_randtest(A, state, 100, nf);
+        nf_mat_randtest(B, state, 100, nf);
+        nf_mat_randtest(C, state, 100, nf);
+
+        nf_mat_mul(C, A, B, nf);
+        nf_mat_mul_classical(D, A, B, nf);
+
+        result = (nf_mat_equal(C, D, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("m = %wd, n = %wd, k = %wd\n", m, n, k);
+           abort();
+        }
+
+        nf_mat_clear(A, nf);
+        nf_mat_clear(B, nf);
+        nf_mat_clear(C, nf);
+        nf_mat_clear(D, nf);
+         
+        nf_clear(nf);
+    }
+    
+    /* test aliasing C and A */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_mat_t A, B, C;
+        slong m, n;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+
+        nf_mat_init(A, m, n, nf);
+        nf_mat_init(B, n, n, nf);
+        nf_mat_init(C, m, n, nf);
+
+        nf_mat_randtest(A, state, 100, nf);
+        nf_mat_randtest(B, state, 100, nf);
+
+        nf_mat_mul(C, A, B, nf);
+        nf_mat_mul(A, A, B, nf);
+
+        result = (nf_mat_equal(A, C, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("m = %wd, n = %wd\n", m, n);
+           abort();
+        }
+
+        nf_mat_clear(A, nf);
+        nf_mat_clear(B, nf);
+        nf_mat_clear(C, nf);
+         
+        nf_clear(nf);
+    }
+
+    /* test multiplication by the identity */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_mat_t A, B, C;
+        slong m, n;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+
+        nf_mat_init(A, m, n, nf);
+        nf_mat_init(B, n, n, nf);
+        nf_mat_init(C, m, n, nf);
+
+        nf_mat_randtest(A, state, 100, nf);
+        nf_mat_one(B, nf);
+
+        nf_mat_mul(C, A, B, nf);
+
+        result = (nf_mat_equal(A, C, nf));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           flint_printf("m = %wd, n = %wd\n", m, n);
+           abort();
+        }
+
+        nf_mat_clear(A, nf);
+        nf_mat_clear(B, nf);
+        nf_mat_clear(C, nf);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
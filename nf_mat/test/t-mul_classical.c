@@ -0,0 +1,92 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include <stdio.h>
+#include "nf.h"
+#include "nf_elem.h"
+#include "nf_mat.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    flint_printf("mul_classical....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* test against sums of products computed with nf_elem_mul */
+    for (i = 0; i < 100 * antic_test_multiplier(); i++)
+    {
+        nf_t nf;
+        nf_mat_t A, B, C;
+        nf_elem_t s, p;
+        slong m, n, k, r, c, l;
+
+        nf_init_randtest(nf, state, 20, 100);
+
+        m = n_randint(state, 8);
+        n = n_randint(state, 8);
+        k = n_randint(state, 8);
+
+        nf_mat_init(A, m, k, nf);
+        nf_mat_init(B, k, n, nf);
+        nf_mat_init(C, m, n, nf);
+        nf_elem_init(s, nf);
+        nf_elem_init(p, nf);
+
+        nf_mat_randtest(A, state, 100, nf);
+        nf_mat_randtest(B, state, 100, nf);
+        nf_mat_randtest(C, state, 100, nf);
+
+        nf_mat_mul_classical(C, A, B, nf);
+
+        for (r = 0; r < m; r++)
+        {
+            for (c = 0; c < n; c++)
+            {
+                nf_elem_zero(s, nf);
+
+                for (l = 0; l < k; l++)
+                {
+                    nf_elem_mul(p, nf_mat_entry(A, r, l),
+                                   nf_mat_entry(B, l, c), nf);
+                    nf_elem_add(s, s, p, nf);
+                }
+
+                result = (nf_elem_equal(s, nf_mat_entry(C, r, c), nf));
+                if (!result)
+                {
+                   printf("FAIL:\n");
+                   flint_printf("m = %wd, n = %wd, k = %wd\n", m, n, k);
+                   flint_printf("r = %wd, c = %wd\n", r, c);
+                   printf("s = "); nf_elem_print_pretty(s, nf, "x"); printf("\n");
+                   printf("C = "); nf_elem_print_pretty(nf_mat_entry(C, r, c), nf, "x"); printf("\n");
+                   abort();
+                }
+            }
+        }
+
+        nf_mat_clear(A, nf);
+        nf_mat_clear(B, nf);
+        nf_mat_clear(C, nf);
+        nf_elem_clear(s, nf);
+        nf_elem_clear(p, nf);
+         
+        nf_clear(nf);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+#include "nf_mat.h"
+
+void nf_mat_zero(nf_mat_t mat, const nf_t nf)
+{
+   slong i, j;
+
+   for (i = 0; i < mat->r; i++)
+   {
+      for (j = 0; j < mat->c; j++)
+         nf_elem_zero(nf_mat_entry(mat, i, j), nf);
+   }
+}
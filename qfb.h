@@ -34,6 +34,37 @@ typedef struct qfb
 
 typedef qfb qfb_t[1];
 
+/*
+   Forms whose discriminant satisfies |D| < 2^QFB_SMALL_BITS, for which the
+   word size kernels qfb_small_* can be used.
+*/
+typedef struct qfb_small
+{
+    slong a;
+    slong b;
+    slong c;
+} qfb_small;
+
+typedef qfb_small qfb_small_t[1];
+
+#define QFB_SMALL_BITS (FLINT_BITS - 2)
+
+/*
+   Forms whose discriminant satisfies |D| < 2^QFB_DSMALL_BITS, for which the
+   double word kernels qfb_dsmall_* can be used. Each coefficient is a signed
+   double word in two's complement, least significant limb first.
+*/
+typedef struct qfb_dsmall
+{
+    ulong a[2];
+    ulong b[2];
+    ulong c[2];
+} qfb_dsmall;
+
+typedef qfb_dsmall qfb_dsmall_t[1];
+
+#define QFB_DSMALL_BITS (2*FLINT_BITS - 8)
+
 typedef struct
 {
    qfb_t q;
@@ -41,6 +72,49 @@ typedef struct
    slong iter;
 } qfb_hash_t;
 
+typedef struct
+{
+   int sign;   /* compose with f (1), its inverse (-1) or nothing (0) */
+   ulong pow3; /* then cube this many times */
+   ulong pow2; /* then square this many times */
+} qfb_dbchain_step;
+
+typedef struct
+{
+   qfb_dbchain_step * steps;
+   slong length;
+   slong alloc;
+} qfb_dbchain_struct;
+
+typedef qfb_dbchain_struct qfb_dbchain_t[1];
+
+/*
+   Number of scratch integers needed by the generic NUCOMP, NUDUPL, NUCUBE
+   and reduction.
+*/
+#define QFB_CTX_TEMPS 24
+
+/*
+   Number of small primes for which D mod p and the prime forms are cached.
+*/
+#define QFB_CTX_PRIMES 64
+
+typedef struct
+{
+   fmpz_t D;                 /* discriminant */
+   fmpz_t L;                 /* |D|^(1/4) */
+   qfb_t one;                /* principal form */
+   fmpz tmp[QFB_CTX_TEMPS];  /* scratch for composition and reduction */
+   qfb_t q1;                 /* scratch forms for powering */
+   qfb_t q2;
+   slong num_primes;         /* 0 until the small prime data is computed */
+   ulong primes[QFB_CTX_PRIMES]; /* the first QFB_CTX_PRIMES primes */
+   ulong Dmod[QFB_CTX_PRIMES];   /* D mod primes[i] */
+   qfb * prime_forms;        /* prime forms for primes[i], a = 0 if unknown */
+} qfb_ctx_struct;
+
+typedef qfb_ctx_struct qfb_ctx_t[1];
+
 static __inline__
 void qfb_init(qfb_t q)
 {
@@ -119,6 +193,8 @@ void qfb_hash_insert(qfb_hash_t * qhash, qfb_t q,
 
 slong qfb_hash_find(qfb_hash_t * qhash, qfb_t q, slong depth);
 
+void _qfb_reduce(qfb_t r, qfb_t f, fmpz_t D, fmpz * tmp);
+
 void qfb_reduce(qfb_t r, qfb_t f, fmpz_t D);
 
 int qfb_is_reduced(qfb_t r);
@@ -127,16 +203,50 @@ slong qfb_reduced_forms(qfb ** forms, slong d);
 
 slong qfb_reduced_forms_large(qfb ** forms, slong d);
 
+void _qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g,
+                                      fmpz_t D, fmpz_t L, fmpz * tmp);
+
 void qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g, fmpz_t D, fmpz_t L);
 
+void qfb_nucomp_reduce(qfb_t r, const qfb_t f, const qfb_t g,
+                                                   fmpz_t D, fmpz_t L);
+
+void _qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L, fmpz * tmp);
+
 void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L);
 
+void _qfb_nucube(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L, fmpz * tmp);
+
+void qfb_nucube(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L);
+
 void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp);
 
 void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t exp);
 
 void qfb_pow_with_root(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e, fmpz_t L);
 
+static __inline__
+void qfb_dbchain_init(qfb_dbchain_t chain)
+{
+   chain->steps = NULL;
+   chain->length = 0;
+   chain->alloc = 0;
+}
+
+static __inline__
+void qfb_dbchain_clear(qfb_dbchain_t chain)
+{
+   if (chain->alloc)
+      flint_free(chain->steps);
+}
+
+void qfb_dbchain_set_fmpz(qfb_dbchain_t chain, const fmpz_t e);
+
+void qfb_pow_dbchain(qfb_t r, qfb_t f, fmpz_t D,
+                                        const qfb_dbchain_t chain, fmpz_t L);
+
+void qfb_pow_fmpz(qfb_t r, qfb_t f, fmpz_t D, const fmpz_t e);
+
 static __inline__
 void qfb_inverse(qfb_t r, qfb_t f)
 {
@@ -201,9 +311,482 @@ int qfb_is_primitive(qfb_t f)
 
 void qfb_prime_form(qfb_t r, fmpz_t D, fmpz_t p);
 
+/* Contexts  ****************************************************************/
+
+void qfb_ctx_init_with_root(qfb_ctx_t ctx, const fmpz_t D, const fmpz_t L);
+
+void qfb_ctx_init(qfb_ctx_t ctx, const fmpz_t D);
+
+void qfb_ctx_clear(qfb_ctx_t ctx);
+
+void _qfb_ctx_precompute_primes(qfb_ctx_t ctx);
+
+static __inline__
+void qfb_ctx_precompute_primes(qfb_ctx_t ctx)
+{
+   if (ctx->num_primes == 0)
+      _qfb_ctx_precompute_primes(ctx);
+}
+
+static __inline__
+void qfb_principal_form_ctx(qfb_t f, qfb_ctx_t ctx)
+{
+   qfb_set(f, ctx->one);
+}
+
+static __inline__
+int qfb_is_principal_form_ctx(qfb_t f, qfb_ctx_t ctx)
+{
+   return qfb_is_principal_form(f, ctx->D);
+}
+
+void qfb_prime_form_ctx(qfb_t r, ulong p, qfb_ctx_t ctx);
+
+void qfb_reduce_ctx(qfb_t r, qfb_t f, qfb_ctx_t ctx);
+
+void qfb_nucomp_ctx(qfb_t r, const qfb_t f, const qfb_t g, qfb_ctx_t ctx);
+
+void qfb_nucomp_reduce_ctx(qfb_t r, const qfb_t f, const qfb_t g,
+                                                             qfb_ctx_t ctx);
+
+void qfb_nudupl_ctx(qfb_t r, const qfb_t f, qfb_ctx_t ctx);
+
+void qfb_nucube_ctx(qfb_t r, const qfb_t f, qfb_ctx_t ctx);
+
+void qfb_pow_ui_ctx(qfb_t r, qfb_t f, ulong exp, qfb_ctx_t ctx);
+
+void qfb_pow_ctx(qfb_t r, qfb_t f, const fmpz_t e, qfb_ctx_t ctx);
+
+void qfb_pow_dbchain_ctx(qfb_t r, qfb_t f,
+                                   const qfb_dbchain_t chain, qfb_ctx_t ctx);
+
+/* Word size forms  *********************************************************/
+
+static __inline__
+int qfb_small_fits(const fmpz_t D)
+{
+   return fmpz_sgn(D) < 0 && fmpz_bits(D) <= QFB_SMALL_BITS;
+}
+
+/*
+   Whether f is a reduced form of discriminant D for which the word size
+   kernels can be used. Up to sign conditions, any such form fits in
+   a qfb_small.
+*/
+static __inline__
+int _qfb_is_small(const qfb_t f, const fmpz_t D)
+{
+   return qfb_small_fits(D) && fmpz_cmp(f->c, f->a) >= 0
+                            && fmpz_cmpabs(f->b, f->a) <= 0;
+}
+
+static __inline__
+void qfb_small_set_qfb(qfb_small_t r, const qfb_t f)
+{
+   r->a = fmpz_get_si(f->a);
+   r->b = fmpz_get_si(f->b);
+   r->c = fmpz_get_si(f->c);
+}
+
+static __inline__
+void qfb_set_qfb_small(qfb_t r, const qfb_small_t f)
+{
+   fmpz_set_si(r->a, f->a);
+   fmpz_set_si(r->b, f->b);
+   fmpz_set_si(r->c, f->c);
+}
+
+static __inline__
+void qfb_small_principal_form(qfb_small_t f, slong D)
+{
+   f->a = 1;
+   f->b = D & 1;
+   f->c = (f->b - D)/4;
+}
+
+/*
+   Exact quotient of the double word {hi, lo} by d != 0, assuming the
+   quotient fits in a word. Only the low FLINT_BITS bits of the quotient
+   are computed, using the inverse of the odd part of d mod 2^FLINT_BITS,
+   so this also works for signed (two's complement) dividends.
+*/
+static __inline__
+ulong _qfb_small_divexact(ulong hi, ulong lo, ulong d)
+{
+   ulong inv;
+   unsigned int e;
+   int i;
+
+   count_trailing_zeros(e, d);
+   if (e != 0)
+   {
+      lo = (lo >> e) | (hi << (FLINT_BITS - e));
+      d >>= e;
+   }
+
+   inv = (3*d) ^ 2; /* correct to 5 bits */
+   for (i = 0; i < 4; i++)
+      inv *= 2 - d*inv;
+
+   return lo*inv;
+}
+
+/*
+   Set c to (b^2 - D)/(4a) for a > 0 and D < 0, which must be exact.
+*/
+static __inline__
+slong _qfb_small_c(slong a, slong b, slong D)
+{
+   ulong hi, lo;
+
+   umul_ppmm(hi, lo, FLINT_ABS(b), FLINT_ABS(b));
+   add_ssaaaa(hi, lo, hi, lo, 0, -D);
+
+   lo = (lo >> 2) | (hi << (FLINT_BITS - 2));
+   hi >>= 2;
+
+   return (slong) _qfb_small_divexact(hi, lo, a);
+}
+
+/*
+   Return g = gcd(x, y) >= 0 and set u, v such that u*x + v*y = g.
+*/
+static __inline__
+slong _qfb_small_xgcd(slong * u, slong * v, slong x, slong y)
+{
+   slong u0 = 1, v0 = 0, u1 = 0, v1 = 1, q, t;
+
+   while (y != 0)
+   {
+      q = x / y;
+
+      t = x - q*y;
+      x = y;
+      y = t;
+
+      t = u0 - q*u1;
+      u0 = u1;
+      u1 = t;
+
+      t = v0 - q*v1;
+      v0 = v1;
+      v1 = t;
+   }
+
+   if (x < 0)
+   {
+      x = -x;
+      u0 = -u0;
+      v0 = -v0;
+   }
+
+   *u = u0;
+   *v = v0;
+
+   return x;
+}
+
+/*
+   As per fmpz_xgcd_partial, for nonnegative r2 and r1.
+*/
+static __inline__
+void _qfb_small_xgcd_partial(slong * co2, slong * co1,
+                                        slong * r2, slong * r1, slong L)
+{
+   slong q, t;
+
+   *co2 = 0;
+   *co1 = -1;
+
+   while (*r1 != 0 && *r1 > L)
+   {
+      q = *r2 / *r1;
+
+      t = *r2 - q * *r1;
+      *r2 = *r1;
+      *r1 = t;
+
+      t = *co2 - q * *co1;
+      *co2 = *co1;
+      *co1 = t;
+   }
+}
+
+void qfb_small_reduce(qfb_small_t r, const qfb_small_t f, slong D);
+
+void qfb_small_nucomp(qfb_small_t r, const qfb_small_t f,
+                                      const qfb_small_t g, slong D, slong L);
+
+void qfb_small_nudupl(qfb_small_t r, const qfb_small_t f, slong D, slong L);
+
+void qfb_small_pow_ui(qfb_small_t r, const qfb_small_t f, slong D, ulong exp);
+
+void qfb_small_pow(qfb_small_t r, const qfb_small_t f, slong D,
+                                                             const fmpz_t e);
+
+/* Double word forms  *******************************************************/
+
+/*
+   Arithmetic on signed double words {x, 2} in two's complement. Products
+   are only computed modulo 2^(2*FLINT_BITS), so they are exact whenever
+   the result fits in a signed double word.
+*/
+static __inline__
+void _qfb_dw_set_si(ulong * r, slong x)
+{
+   r[0] = x;
+   r[1] = x < 0 ? ~UWORD(0) : 0;
+}
+
+static __inline__
+void _qfb_dw_set(ulong * r, const ulong * x)
+{
+   r[0] = x[0];
+   r[1] = x[1];
+}
+
+static __inline__
+int _qfb_dw_sgn(const ulong * x)
+{
+   if (x[1] != 0)
+      return (slong) x[1] < 0 ? -1 : 1;
+
+   return x[0] != 0;
+}
+
+static __inline__
+int _qfb_dw_cmp(const ulong * x, const ulong * y)
+{
+   if (x[1] != y[1])
+      return (slong) x[1] < (slong) y[1] ? -1 : 1;
+
+   if (x[0] != y[0])
+      return x[0] < y[0] ? -1 : 1;
+
+   return 0;
+}
+
+static __inline__
+void _qfb_dw_add(ulong * r, const ulong * x, const ulong * y)
+{
+   add_ssaaaa(r[1], r[0], x[1], x[0], y[1], y[0]);
+}
+
+static __inline__
+void _qfb_dw_sub(ulong * r, const ulong * x, const ulong * y)
+{
+   sub_ddmmss(r[1], r[0], x[1], x[0], y[1], y[0]);
+}
+
+static __inline__
+void _qfb_dw_neg(ulong * r, const ulong * x)
+{
+   sub_ddmmss(r[1], r[0], UWORD(0), UWORD(0), x[1], x[0]);
+}
+
+static __inline__
+void _qfb_dw_abs(ulong * r, const ulong * x)
+{
+   if ((slong) x[1] < 0)
+      _qfb_dw_neg(r, x);
+   else
+      _qfb_dw_set(r, x);
+}
+
+static __inline__
+int _qfb_dw_cmpabs(const ulong * x, const ulong * y)
+{
+   ulong s[2], t[2];
+
+   _qfb_dw_abs(s, x);
+   _qfb_dw_abs(t, y);
+
+   return _qfb_dw_cmp(s, t);
+}
+
+static __inline__
+void _qfb_dw_mul(ulong * r, const ulong * x, const ulong * y)
+{
+   ulong hi, lo;
+
+   umul_ppmm(hi, lo, x[0], y[0]);
+   r[1] = hi + x[0]*y[1] + x[1]*y[0];
+   r[0] = lo;
+}
+
+static __inline__
+void _qfb_dw_mul_si(ulong * r, const ulong * x, slong y)
+{
+   ulong t[2];
+
+   _qfb_dw_set_si(t, y);
+   _qfb_dw_mul(r, x, t);
+}
+
+static __inline__
+void _qfb_dw_smul(ulong * r, slong x, slong y)
+{
+   smul_ppmm(r[1], r[0], x, y);
+}
+
+/*
+   Set q and r to the quotient and remainder of the floor division of x by
+   y != 0, so that r has the sign of y.
+*/
+static __inline__
+void _qfb_dw_fdiv_qr(ulong * q, ulong * r, const ulong * x, const ulong * y)
+{
+   mp_limb_t n[2], d[2], nq[2], nr[2];
+   int sx = _qfb_dw_sgn(x), sy = _qfb_dw_sgn(y);
+
+   _qfb_dw_abs(n, x);
+   _qfb_dw_abs(d, y);
+
+   nq[1] = nr[1] = 0;
+   mpn_tdiv_qr(nq, nr, 0, n, 2, d, d[1] != 0 ? 2 : 1);
+
+   if (sx < 0)
+      _qfb_dw_neg(nr, nr);
+
+   if ((sx < 0) != (sy < 0))
+   {
+      _qfb_dw_neg(nq, nq);
+
+      if (nr[0] != 0 || nr[1] != 0)
+      {
+         sub_ddmmss(nq[1], nq[0], nq[1], nq[0], UWORD(0), UWORD(1));
+         _qfb_dw_add(nr, nr, y);
+      }
+   }
+
+   _qfb_dw_set(q, nq);
+   _qfb_dw_set(r, nr);
+}
+
+/*
+   Set q to x/y, which must be exact.
+*/
+static __inline__
+void _qfb_dw_divexact(ulong * q, const ulong * x, const ulong * y)
+{
+   ulong r[2];
+
+   _qfb_dw_fdiv_qr(q, r, x, y);
+}
+
+/*
+   Return x mod d in [0, d) for d != 0.
+*/
+static __inline__
+ulong _qfb_dw_fdiv_ui(const ulong * x, ulong d)
+{
+   ulong t[2], r;
+
+   _qfb_dw_abs(t, x);
+   r = mpn_mod_1(t, 2, d);
+
+   return ((slong) x[1] < 0 && r != 0) ? d - r : r;
+}
+
+static __inline__
+int qfb_dsmall_fits(const fmpz_t D)
+{
+   return fmpz_sgn(D) < 0 && fmpz_bits(D) <= QFB_DSMALL_BITS;
+}
+
+/*
+   As per _qfb_is_small, for the double word kernels.
+*/
+static __inline__
+int _qfb_is_dsmall(const qfb_t f, const fmpz_t D)
+{
+   return qfb_dsmall_fits(D) && fmpz_cmp(f->c, f->a) >= 0
+                             && fmpz_cmpabs(f->b, f->a) <= 0;
+}
+
+static __inline__
+void qfb_dsmall_set_qfb(qfb_dsmall_t r, const qfb_t f)
+{
+   fmpz_get_signed_uiui(r->a + 1, r->a, f->a);
+   fmpz_get_signed_uiui(r->b + 1, r->b, f->b);
+   fmpz_get_signed_uiui(r->c + 1, r->c, f->c);
+}
+
+static __inline__
+void qfb_set_qfb_dsmall(qfb_t r, const qfb_dsmall_t f)
+{
+   fmpz_set_signed_uiui(r->a, f->a[1], f->a[0]);
+   fmpz_set_signed_uiui(r->b, f->b[1], f->b[0]);
+   fmpz_set_signed_uiui(r->c, f->c[1], f->c[0]);
+}
+
+static __inline__
+void qfb_dsmall_principal_form(qfb_dsmall_t f, const ulong * D)
+{
+   _qfb_dw_set_si(f->a, 1);
+   _qfb_dw_set_si(f->b, D[0] & 1);
+   _qfb_dw_sub(f->c, f->b, D);
+
+   f->c[0] = (f->c[0] >> 2) | (f->c[1] << (FLINT_BITS - 2));
+   f->c[1] >>= 2;
+}
+
+/*
+   Set c to (b^2 - D)/(4a) for a > 0 and D < 0, which must be exact. The
+   square is computed in full, so b need not be reduced modulo a.
+*/
+static __inline__
+void _qfb_dsmall_c(ulong * c, const ulong * a, const ulong * b,
+                                                         const ulong * D)
+{
+   mp_limb_t t[2], n[4], q[4], r[2];
+
+   _qfb_dw_abs(t, b);
+   mpn_mul_n(n, t, t, 2);
+   _qfb_dw_neg(t, D);
+   mpn_add(n, n, 4, t, 2);
+   mpn_rshift(n, n, 4, 2);
+   mpn_tdiv_qr(q, r, 0, n, 4, a, a[1] != 0 ? 2 : 1);
+
+   c[0] = q[0];
+   c[1] = q[1];
+}
+
+/*
+   Return floor(|D|^(1/4)) for D < 0.
+*/
+static __inline__
+slong _qfb_dsmall_root4(const ulong * D)
+{
+   mp_limb_t t[2], s, L;
+
+   _qfb_dw_neg(t, D);
+   mpn_sqrtrem(&s, NULL, t, t[1] != 0 ? 2 : 1);
+   mpn_sqrtrem(&L, NULL, &s, 1);
+
+   return L;
+}
+
+void qfb_dsmall_reduce(qfb_dsmall_t r, const qfb_dsmall_t f, const ulong * D);
+
+void qfb_dsmall_nucomp(qfb_dsmall_t r, const qfb_dsmall_t f,
+                           const qfb_dsmall_t g, const ulong * D, slong L);
+
+void qfb_dsmall_nudupl(qfb_dsmall_t r, const qfb_dsmall_t f,
+                                                  const ulong * D, slong L);
+
+void qfb_dsmall_pow_ui(qfb_dsmall_t r, const qfb_dsmall_t f,
+                                                const ulong * D, ulong exp);
+
+void qfb_dsmall_pow(qfb_dsmall_t r, const qfb_dsmall_t f, const ulong * D,
+                                                             const fmpz_t e);
+
 int qfb_exponent_element(fmpz_t exponent, qfb_t f, 
                                           fmpz_t n, ulong B1, ulong B2_sqrt);
 
+int qfb_exponent_element_ctx(fmpz_t exponent, qfb_t f,
+                                    ulong B1, ulong B2_sqrt, qfb_ctx_t ctx);
+
 int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c);
 
 int qfb_exponent_grh(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt);
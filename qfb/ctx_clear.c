@@ -0,0 +1,40 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void qfb_ctx_clear(qfb_ctx_t ctx)
+{
+   slong i;
+
+   fmpz_clear(ctx->D);
+   fmpz_clear(ctx->L);
+
+   qfb_clear(ctx->one);
+
+   for (i = 0; i < QFB_CTX_TEMPS; i++)
+      fmpz_clear(ctx->tmp + i);
+
+   qfb_clear(ctx->q1);
+   qfb_clear(ctx->q2);
+
+   if (ctx->num_primes != 0)
+   {
+      for (i = 0; i < ctx->num_primes; i++)
+         qfb_clear(ctx->prime_forms + i);
+
+      flint_free(ctx->prime_forms);
+   }
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void qfb_ctx_init_with_root(qfb_ctx_t ctx, const fmpz_t D, const fmpz_t L)
+{
+   slong i;
+
+   fmpz_init_set(ctx->D, D);
+   fmpz_init_set(ctx->L, L);
+
+   qfb_init(ctx->one);
+   qfb_principal_form(ctx->one, ctx->D);
+
+   for (i = 0; i < QFB_CTX_TEMPS; i++)
+      fmpz_init(ctx->tmp + i);
+
+   qfb_init(ctx->q1);
+   qfb_init(ctx->q2);
+
+   /* the small prime data is only computed when first needed */
+   ctx->num_primes = 0;
+   ctx->prime_forms = NULL;
+}
+
+void qfb_ctx_init(qfb_ctx_t ctx, const fmpz_t D)
+{
+   fmpz_t L;
+
+   fmpz_init(L);
+   fmpz_abs(L, D);
+   fmpz_root(L, L, 4);
+
+   qfb_ctx_init_with_root(ctx, D, L);
+
+   fmpz_clear(L);
+}
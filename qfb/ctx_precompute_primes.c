@@ -0,0 +1,37 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/ulong_extras.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void _qfb_ctx_precompute_primes(qfb_ctx_t ctx)
+{
+   ulong p = 1;
+   slong i;
+
+   ctx->prime_forms = flint_malloc(QFB_CTX_PRIMES*sizeof(qfb));
+
+   for (i = 0; i < QFB_CTX_PRIMES; i++)
+   {
+      p = n_nextprime(p, 0);
+
+      ctx->primes[i] = p;
+      ctx->Dmod[i] = fmpz_fdiv_ui(ctx->D, p);
+
+      qfb_init(ctx->prime_forms + i);
+   }
+
+   ctx->num_primes = QFB_CTX_PRIMES;
+}
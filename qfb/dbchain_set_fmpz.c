@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+/*
+   Remove all factors of 2 and 3 from n, returning their multiplicities.
+*/
+static void
+qfb_dbchain_strip(fmpz_t n, ulong * pow2, ulong * pow3, const fmpz_t three)
+{
+   *pow2 = fmpz_val2(n);
+   fmpz_fdiv_q_2exp(n, n, *pow2);
+   *pow3 = fmpz_remove(n, n, three);
+}
+
+/*
+   Write e = 2^x 3^y m with m coprime to 6. If m > 1 then one of m - 1 and
+   m + 1 is divisible by 6, and we continue with whichever has the smaller
+   part coprime to 6. This gives a double-base chain, i.e. the exponents of
+   2 and 3 in the terms of e = sum +/-2^x_i 3^y_i are non-increasing, so it
+   can be evaluated Horner fashion with one composition per term, see
+   Doche and Habsieger, "A tree-based approach for computing double-base
+   chains", ACISP 2008, LNCS 5107, pp. 433--446.
+*/
+void qfb_dbchain_set_fmpz(qfb_dbchain_t chain, const fmpz_t e)
+{
+   fmpz_t n, n1, three;
+   ulong pow2, pow3, pow21, pow31;
+   qfb_dbchain_step t;
+   slong i;
+
+   if (fmpz_sgn(e) < 0)
+   {
+      printf("Exception (qfb_dbchain_set_fmpz). Negative exponent.\n");
+      abort();
+   }
+
+   chain->length = 0;
+
+   if (fmpz_is_zero(e))
+      return;
+
+   fmpz_init_set(n, e);
+   fmpz_init(n1);
+   fmpz_init_set_ui(three, 3);
+
+   qfb_dbchain_strip(n, &pow2, &pow3, three);
+
+   /* steps are generated from the least significant end */
+   while (1)
+   {
+      if (chain->length == chain->alloc)
+      {
+         chain->alloc = FLINT_MAX(2*chain->alloc, 16);
+         chain->steps = (qfb_dbchain_step *) flint_realloc(chain->steps,
+                                     chain->alloc*sizeof(qfb_dbchain_step));
+      }
+
+      chain->steps[chain->length].pow2 = pow2;
+      chain->steps[chain->length].pow3 = pow3;
+
+      if (fmpz_is_one(n))
+      {
+         chain->steps[chain->length++].sign = 0;
+         break;
+      }
+
+      fmpz_add_ui(n1, n, 1);
+      fmpz_sub_ui(n, n, 1);
+
+      qfb_dbchain_strip(n, &pow2, &pow3, three);
+      qfb_dbchain_strip(n1, &pow21, &pow31, three);
+
+      if (fmpz_cmp(n, n1) <= 0)
+         chain->steps[chain->length++].sign = 1;
+      else
+      {
+         chain->steps[chain->length++].sign = -1;
+         fmpz_swap(n, n1);
+         pow2 = pow21;
+         pow3 = pow31;
+      }
+   }
+
+   /* put the steps in order of evaluation */
+   for (i = 0; i < chain->length/2; i++)
+   {
+      t = chain->steps[i];
+      chain->steps[i] = chain->steps[chain->length - i - 1];
+      chain->steps[chain->length - i - 1] = t;
+   }
+
+   fmpz_clear(n);
+   fmpz_clear(n1);
+   fmpz_clear(three);
+}
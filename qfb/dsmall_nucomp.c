@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "qfb.h"
+
+/*
+   As per qfb_small_nucomp. For reduced f and g with |D| < 2^QFB_DSMALL_BITS
+   the leading coefficients and the cofactors of the partial gcd fit in a
+   word. The remaining quantities are bounded by |D| in absolute value and
+   are kept in double words, except for c, which is computed from a and b.
+*/
+void qfb_dsmall_nucomp(qfb_dsmall_t r, const qfb_dsmall_t f,
+                           const qfb_dsmall_t g, const ulong * D, slong L)
+{
+   slong a1, a2, b2, k, m, s, sp, ss, t, u2, v2;
+   ulong v1, c2[2], ca[2], cb[2], x[2], y[2];
+
+   if (f->a[0] > g->a[0])
+   {
+      qfb_dsmall_nucomp(r, g, f, D, L);
+      return;
+   }
+
+   a1 = f->a[0];
+   a2 = g->a[0];
+   b2 = g->b[0];
+   _qfb_dw_set(c2, g->c);
+
+   /* b values of forms of the same discriminant have the same parity */
+   ss = ((slong) f->b[0] + b2)/2;
+   m = ((slong) f->b[0] - b2)/2;
+
+   t = a2 % a1;
+   if (t == 0)
+   {
+      v1 = 0;
+      sp = a1;
+   } else
+      sp = n_gcdinv(&v1, t, a1);
+
+   _qfb_dw_smul(x, m, v1);
+   k = _qfb_dw_fdiv_ui(x, a1);
+
+   if (sp != 1)
+   {
+      s = _qfb_small_xgcd(&v2, &u2, ss, sp);
+
+      if (s != 1)
+      {
+         a1 /= s;
+         a2 /= s;
+      }
+
+      /* k = k*u2 - v2*c2 mod a1, reducing c2 first to keep it small */
+      _qfb_dw_smul(x, k, u2);
+      _qfb_dw_smul(y, v2, _qfb_dw_fdiv_ui(c2, a1));
+      _qfb_dw_sub(x, x, y);
+      k = _qfb_dw_fdiv_ui(x, a1);
+
+      if (s != 1)
+         _qfb_dw_mul_si(c2, c2, s);
+   }
+
+   if (a1 < L)
+   {
+      _qfb_dw_smul(ca, a2, a1);
+      _qfb_dw_smul(cb, a2, 2*k);
+      _qfb_dw_set_si(x, b2);
+      _qfb_dw_add(cb, cb, x);
+   } else
+   {
+      slong r1, r2, co1, co2;
+      ulong d[2], m1[2], m2[2], tt[2];
+
+      r2 = a1;
+      r1 = k;
+
+      _qfb_small_xgcd_partial(&co2, &co1, &r2, &r1, L);
+
+      _qfb_dw_smul(tt, a2, r1);
+      _qfb_dw_set_si(d, a1);
+
+      /* m1 = (m*co1 + t)/a1 */
+      _qfb_dw_smul(x, m, co1);
+      _qfb_dw_add(x, x, tt);
+      _qfb_dw_divexact(m1, x, d);
+
+      /* m2 = (ss*r1 - c2*co1)/a1 */
+      _qfb_dw_smul(x, ss, r1);
+      _qfb_dw_mul_si(y, c2, co1);
+      _qfb_dw_sub(x, x, y);
+      _qfb_dw_divexact(m2, x, d);
+
+      _qfb_dw_mul_si(x, m1, r1);
+      _qfb_dw_mul_si(y, m2, co1);
+      if (co1 < 0)
+         _qfb_dw_sub(ca, x, y);
+      else
+         _qfb_dw_sub(ca, y, x);
+
+      /* cb = 2*(t - ca*co2)/co1 - b2 */
+      _qfb_dw_mul_si(x, ca, co2);
+      _qfb_dw_sub(x, tt, x);
+      _qfb_dw_add(x, x, x);
+      _qfb_dw_set_si(d, co1);
+      _qfb_dw_divexact(cb, x, d);
+      _qfb_dw_set_si(x, b2);
+      _qfb_dw_sub(cb, cb, x);
+
+      /* reduce cb modulo 2ca, with the sign of 2ca */
+      _qfb_dw_add(d, ca, ca);
+      _qfb_dw_fdiv_qr(x, cb, cb, d);
+
+      _qfb_dw_abs(ca, ca);
+   }
+
+   _qfb_dsmall_c(r->c, ca, cb, D);
+   _qfb_dw_set(r->a, ca);
+   _qfb_dw_set(r->b, cb);
+}
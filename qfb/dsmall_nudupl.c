@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "qfb.h"
+
+/*
+   As per qfb_small_nudupl, with the same bounds as qfb_dsmall_nucomp.
+*/
+void qfb_dsmall_nudupl(qfb_dsmall_t r, const qfb_dsmall_t f,
+                                                   const ulong * D, slong L)
+{
+   slong a1, b, k, s, t;
+   ulong v2, c1[2], ca[2], cb[2], x[2];
+
+   a1 = f->a[0];
+   b = f->b[0];
+
+   t = FLINT_ABS(b) % a1;
+   if (t == 0)
+   {
+      s = a1;
+      v2 = 0;
+   } else
+      s = n_gcdinv(&v2, t, a1);
+
+   _qfb_dw_set(c1, f->c);
+
+   if (s != 1)
+   {
+      a1 /= s;
+      _qfb_dw_mul_si(c1, c1, s);
+   }
+
+   /* k = -v2*c mod a1, where v2*b = s mod a */
+   _qfb_dw_smul(x, v2 % a1, _qfb_dw_fdiv_ui(f->c, a1));
+   k = _qfb_dw_fdiv_ui(x, a1);
+   if (b >= 0)
+      k = -k;
+   if (k < 0)
+      k += a1;
+
+   if (a1 < L)
+   {
+      _qfb_dw_smul(ca, a1, a1);
+      _qfb_dw_smul(cb, a1, 2*k);
+      _qfb_dw_set_si(x, b);
+      _qfb_dw_add(cb, cb, x);
+   } else
+   {
+      slong r1, r2, co1, co2;
+      ulong d[2], m2[2], tt[2], y[2];
+
+      r2 = a1;
+      r1 = k;
+
+      _qfb_small_xgcd_partial(&co2, &co1, &r2, &r1, L);
+
+      _qfb_dw_smul(tt, a1, r1);
+
+      /* m2 = (b*r1 - c1*co1)/a1 */
+      _qfb_dw_smul(x, b, r1);
+      _qfb_dw_mul_si(y, c1, co1);
+      _qfb_dw_sub(x, x, y);
+      _qfb_dw_set_si(d, a1);
+      _qfb_dw_divexact(m2, x, d);
+
+      _qfb_dw_smul(x, r1, r1);
+      _qfb_dw_mul_si(y, m2, co1);
+      if (co1 < 0)
+         _qfb_dw_sub(ca, x, y);
+      else
+         _qfb_dw_sub(ca, y, x);
+
+      /* cb = 2*(t - ca*co2)/co1 - b */
+      _qfb_dw_mul_si(x, ca, co2);
+      _qfb_dw_sub(x, tt, x);
+      _qfb_dw_add(x, x, x);
+      _qfb_dw_set_si(d, co1);
+      _qfb_dw_divexact(cb, x, d);
+      _qfb_dw_set_si(x, b);
+      _qfb_dw_sub(cb, cb, x);
+
+      /* reduce cb modulo 2ca, with the sign of 2ca */
+      _qfb_dw_add(d, ca, ca);
+      _qfb_dw_fdiv_qr(x, cb, cb, d);
+
+      _qfb_dw_abs(ca, ca);
+   }
+
+   _qfb_dsmall_c(r->c, ca, cb, D);
+   _qfb_dw_set(r->a, ca);
+   _qfb_dw_set(r->b, cb);
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void qfb_dsmall_pow(qfb_dsmall_t r, const qfb_dsmall_t f, const ulong * D,
+                                                              const fmpz_t e)
+{
+   slong L, i, bits;
+   qfb_dsmall_t pow;
+
+   if (fmpz_is_zero(e))
+   {
+      qfb_dsmall_principal_form(r, D);
+      return;
+   }
+
+   L = _qfb_dsmall_root4(D);
+   bits = fmpz_bits(e);
+
+   *pow = *f;
+
+   for (i = 0; !fmpz_tstbit(e, i); i++)
+   {
+      qfb_dsmall_nudupl(pow, pow, D, L);
+      qfb_dsmall_reduce(pow, pow, D);
+   }
+
+   *r = *pow;
+
+   for (i++; i < bits; i++)
+   {
+      qfb_dsmall_nudupl(pow, pow, D, L);
+      qfb_dsmall_reduce(pow, pow, D);
+      if (fmpz_tstbit(e, i))
+      {
+         qfb_dsmall_nucomp(r, r, pow, D, L);
+         qfb_dsmall_reduce(r, r, D);
+      }
+   }
+}
@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "qfb.h"
+
+void qfb_dsmall_pow_ui(qfb_dsmall_t r, const qfb_dsmall_t f,
+                                                 const ulong * D, ulong exp)
+{
+   slong L;
+   qfb_dsmall_t pow;
+
+   if (exp == 0)
+   {
+      qfb_dsmall_principal_form(r, D);
+      return;
+   }
+
+   L = _qfb_dsmall_root4(D);
+
+   *pow = *f;
+
+   while ((exp & 1) == 0)
+   {
+      qfb_dsmall_nudupl(pow, pow, D, L);
+      qfb_dsmall_reduce(pow, pow, D);
+      exp >>= 1;
+   }
+
+   *r = *pow;
+   exp >>= 1;
+
+   while (exp)
+   {
+      qfb_dsmall_nudupl(pow, pow, D, L);
+      qfb_dsmall_reduce(pow, pow, D);
+      if (exp & 1)
+      {
+         qfb_dsmall_nucomp(r, r, pow, D, L);
+         qfb_dsmall_reduce(r, r, D);
+      }
+      exp >>= 1;
+   }
+}
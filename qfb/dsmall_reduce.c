@@ -0,0 +1,57 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "qfb.h"
+
+void qfb_dsmall_reduce(qfb_dsmall_t r, const qfb_dsmall_t f, const ulong * D)
+{
+   ulong a[2], b[2], c[2], q[2], t[2];
+   int done = 0;
+
+   _qfb_dw_set(a, f->a);
+   _qfb_dw_set(b, f->b);
+   _qfb_dw_set(c, f->c);
+
+   while (!done)
+   {
+      done = 1;
+
+      if (_qfb_dw_cmp(c, a) < 0)
+      {
+         _qfb_dw_set(t, a);
+         _qfb_dw_set(a, c);
+         _qfb_dw_set(c, t);
+         _qfb_dw_neg(b, b);
+
+         done = 0;
+      }
+
+      if (_qfb_dw_cmpabs(b, a) > 0)
+      {
+         _qfb_dw_add(t, a, a);
+         _qfb_dw_fdiv_qr(q, b, b, t);
+         if (_qfb_dw_cmp(b, a) > 0)
+            _qfb_dw_sub(b, b, t);
+
+         _qfb_dsmall_c(c, a, b, D);
+
+         done = 0;
+      }
+   }
+
+   if (_qfb_dw_cmpabs(b, a) == 0 || _qfb_dw_cmp(a, c) == 0)
+      if (_qfb_dw_sgn(b) < 0)
+         _qfb_dw_neg(b, b);
+
+   _qfb_dw_set(r->a, a);
+   _qfb_dw_set(r->b, b);
+   _qfb_dw_set(r->c, c);
+}
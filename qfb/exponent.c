@@ -23,19 +23,24 @@
 
 int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c)
 {
-   fmpz_t p, exp, n2;
+   fmpz_t exp, n2;
    slong i;
    qfb_t f;
+   qfb_ctx_t ctx, ctx2;
+   qfb_ctx_struct * cur;
+   int init2 = 0;
    ulong pr, nmodpr, s;
    int ret = 1;
    n_primes_t iter;
 
    n_primes_init(iter);
-   fmpz_init(p);
    fmpz_init(n2);
    fmpz_init(exp);
    qfb_init(f);
 
+   /* one context for n, shared by all the prime forms */
+   qfb_ctx_init(ctx, n);
+
    fmpz_set_ui(exponent, 1);
 
    /* find odd prime such that n is a square mod p */
@@ -53,10 +58,8 @@ int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c)
 
       if (i < c + 2)
       {
-         fmpz_set_ui(p, pr);
-      
          /* find prime form of discriminant n */
-         qfb_prime_form(f, n, p);
+         qfb_prime_form_ctx(f, pr, ctx);
          fmpz_set(n2, n);
 
          /* deal with non-fundamental discriminant */
@@ -76,12 +79,31 @@ int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c)
             fmpz_fdiv_q_2exp(n2, n2, 2);
          }
          
-         qfb_reduce(f, f, n2);
+         /* keep a context for a smaller discriminant while it recurs */
+         cur = ctx;
+         if (!fmpz_equal(n2, n))
+         {
+            if (init2 && !fmpz_equal(ctx2->D, n2))
+            {
+               qfb_ctx_clear(ctx2);
+               init2 = 0;
+            }
+
+            if (!init2)
+            {
+               qfb_ctx_init(ctx2, n2);
+               init2 = 1;
+            }
+
+            cur = ctx2;
+         }
+
+         qfb_reduce_ctx(f, f, cur);
          
          if (!fmpz_is_one(exponent))
-            qfb_pow(f, f, n2, exponent);
+            qfb_pow_ctx(f, f, exponent, cur);
 
-         if (!qfb_exponent_element(exp, f, n2, B1, B2_sqrt))
+         if (!qfb_exponent_element_ctx(exp, f, B1, B2_sqrt, cur))
          {
             ret = 0;
             goto cleanup;
@@ -96,7 +118,9 @@ int qfb_exponent(fmpz_t exponent, fmpz_t n, ulong B1, ulong B2_sqrt, slong c)
 
 cleanup:
    qfb_clear(f);
-   fmpz_clear(p);
+   qfb_ctx_clear(ctx);
+   if (init2)
+      qfb_ctx_clear(ctx2);
    fmpz_clear(n2);
    fmpz_clear(exp);
    n_primes_clear(iter);
@@ -21,56 +21,49 @@
 /*
    find which power of the base is the exponent of f
 */
-ulong find_power(qfb_t f, fmpz_t n, ulong base)
+ulong find_power(qfb_t f, qfb_ctx_t ctx, ulong base)
 {
    ulong s = 1;
       
    do
    {
-      qfb_pow_ui(f, f, n, base);
+      qfb_pow_ui_ctx(f, f, base, ctx);
       s *= base;
-   } while (!qfb_is_principal_form(f, n));
+   } while (!qfb_is_principal_form_ctx(f, ctx));
 
    return s;
 }
 
-ulong qfb_exponent_element_stage2(qfb_t f, fmpz_t n, ulong B2_sqrt)
+ulong qfb_exponent_element_stage2(qfb_t f, qfb_ctx_t ctx, ulong B2_sqrt)
 {
    qfb_t pow, pow2, f2;
-   fmpz_t L, r;
+   fmpz_t r;
    slong i, i2, ret = 0;
    slong depth = FLINT_BIT_COUNT(B2_sqrt) + 1;
    qfb_hash_t * qhash = qfb_hash_init(depth);
    
-   fmpz_init(L);
    fmpz_init(r);
-   fmpz_abs(L, n);
-   fmpz_root(L, L, 4);
 
    qfb_init(f2);
    qfb_init(pow);
    qfb_init(pow2);
    qfb_hash_insert(qhash, f, NULL, 1, depth);
 
-   qfb_nucomp(f2, f, f, n, L); /* large primes are odd */
-   qfb_reduce(f2, f2, n);
+   qfb_nucomp_reduce_ctx(f2, f, f, ctx); /* large primes are odd */
 
    qfb_set(pow, f);
    
    for (i = 1; i < B2_sqrt - 1; i += 2) /* baby steps */
    {
-      qfb_nucomp(pow, pow, f2, n, L);
-      qfb_reduce(pow, pow, n);
+      qfb_nucomp_reduce_ctx(pow, pow, f2, ctx);
 
       qfb_hash_insert(qhash, pow, NULL, i + 2, depth);
    }
 
-   qfb_nucomp(pow, pow, f, n, L); /* compute f^B2_sqrt */
-   qfb_reduce(pow, pow, n);
+   qfb_nucomp_reduce_ctx(pow, pow, f, ctx); /* compute f^B2_sqrt */
 
-   qfb_nucomp(pow, pow, pow, n, L); /* we hash for a form or its inverse,
-                                    so we can jump by f^(2x B2_sqrt) */
-   qfb_reduce(pow, pow, n);
+   /* we hash for a form or its inverse, so we can jump by f^(2x B2_sqrt) */
+   qfb_nucomp_reduce_ctx(pow, pow, pow, ctx);
    qfb_set(pow2, pow);
    
    for(i = 2; i <= B2_sqrt; i += 2) /* giant steps */ 
@@ -88,12 +81,10 @@ ulong qfb_exponent_element_stage2(qfb_t f, fmpz_t n, ulong B2_sqrt)
          break;
       }
 
-      qfb_nucomp(pow2, pow2, pow, n, L);
-      qfb_reduce(pow2, pow2, n);
+      qfb_nucomp_reduce_ctx(pow2, pow2, pow, ctx);
    }
 
    fmpz_clear(r);
-   fmpz_clear(L);
    qfb_clear(f2);
    qfb_clear(pow);
    qfb_clear(pow2);
@@ -114,24 +105,25 @@ typedef struct
       need_restarts = 0; \
       if (j == 0) \
       { \
-         qfb_pow(f2, f2, n, exponent); \
+         qfb_pow_ctx(f2, f2, exponent, ctx); \
          goto do_restart1; \
       } \
       j--; \
       qfb_set(pow, restart[j].pow); \
-      qfb_pow(pow, pow, n, exponent); \
+      qfb_pow_ctx(pow, pow, exponent, ctx); \
       i = restart[j].i; \
       n_primes_jump_after(iter, restart[j].pr); \
       pr = restart[j].pr; \
       goto do_restart; \
    } while (0)
 
-int qfb_exponent_element(fmpz_t exponent, qfb_t f, fmpz_t n, ulong B1, ulong B2_sqrt)
+int qfb_exponent_element_ctx(fmpz_t exponent, qfb_t f,
+                                     ulong B1, ulong B2_sqrt, qfb_ctx_t ctx)
 {
    slong i, j, iters = 1024, restart_inc;
    qfb_t pow, oldpow, f2;
    ulong pr, oldpr, s2, sqrt, exp;
-   fmpz_t prod, L, pow2;
+   fmpz_t prod, pow2;
    int ret = 1, num_restarts = 0, need_restarts = 1, clean2 = 0;
    qfb_restart_t restart[128];
    n_primes_t iter;
@@ -152,26 +144,22 @@ int qfb_exponent_element(fmpz_t exponent, qfb_t f, fmpz_t n, ulong B1, ulong B2_
    
    fmpz_init(pow2);
    fmpz_init(prod);
-   fmpz_init(L);
-
-   fmpz_abs(L, n);
-   fmpz_root(L, L, 4);
 
    qfb_set(f2, f);
 
 do_restart1:
    
-   if (qfb_is_principal_form(f2, n))
+   if (qfb_is_principal_form_ctx(f2, ctx))
       goto cleanup2;
 
    /* raise to appropriate power of 2 */
    qfb_set(oldpow, f2);
    fmpz_set_ui(pow2, 2);
    fmpz_pow_ui(pow2, pow2, bits0);
-   qfb_pow(pow, oldpow, n, pow2);
-   if (qfb_is_principal_form(pow, n))
+   qfb_pow_ctx(pow, oldpow, pow2, ctx);
+   if (qfb_is_principal_form_ctx(pow, ctx))
    {
-      ulong s = find_power(oldpow, n, 2);
+      ulong s = find_power(oldpow, ctx, 2);
       fmpz_mul_ui(exponent, exponent, s);
 
       goto cleanup2;
@@ -246,11 +234,11 @@ do_restart:
                fmpz_mul(prod, prod, pow2);
             } else
                fmpz_mul_ui(prod, prod, pr);
-            qfb_pow_with_root(pow, pow, n, prod, L);
+            qfb_pow_ctx(pow, pow, prod, ctx);
          }
 
          /* identity is found, compute exponent recursively */
-         if (qfb_is_principal_form(pow, n))
+         if (qfb_is_principal_form_ctx(pow, ctx))
          {
             qfb_set(pow, oldpow);
             n_primes_jump_after(iter, oldpr);
@@ -266,8 +254,8 @@ do_restart:
                   
                   for (k = 1; k <= exp; k++)
                   {
-                     qfb_pow_ui(pow, pow, n, pr);
-                     if (qfb_is_principal_form(pow, n))
+                     qfb_pow_ui_ctx(pow, pow, pr, ctx);
+                     if (qfb_is_principal_form_ctx(pow, ctx))
                      {
                         fmpz_set_ui(pow2, pr);
                         fmpz_pow_ui(pow2, pow2, k);
@@ -275,8 +263,8 @@ do_restart:
                         for (j = 0; j < num_restarts; j++)
                         {
                            qfb_set(pow, restart[j].pow);
-                           qfb_pow(pow, pow, n, exponent);
-                           if (qfb_is_principal_form(pow, n))
+                           qfb_pow_ctx(pow, pow, exponent, ctx);
+                           if (qfb_is_principal_form_ctx(pow, ctx))
                               break;
                         }
                         go_restart;
@@ -284,15 +272,15 @@ do_restart:
                   }
                } else
                {
-                  qfb_pow_ui(pow, pow, n, pr);
-                  if (qfb_is_principal_form(pow, n))
+                  qfb_pow_ui_ctx(pow, pow, pr, ctx);
+                  if (qfb_is_principal_form_ctx(pow, ctx))
                   {
                      fmpz_mul_ui(exponent, exponent, pr);
                      for (j = 0; j < num_restarts; j++)
                      {
                         qfb_set(pow, restart[j].pow);
-                        qfb_pow(pow, pow, n, exponent);
-                        if (qfb_is_principal_form(pow, n))
+                        qfb_pow_ctx(pow, pow, exponent, ctx);
+                        if (qfb_is_principal_form_ctx(pow, ctx))
                            break;
                      }
                      go_restart;
@@ -303,15 +291,15 @@ do_restart:
       }
    
       /* stage 2 */
-      s2 = qfb_exponent_element_stage2(pow, n, (ulong) ((double) iters * quot));
+      s2 = qfb_exponent_element_stage2(pow, ctx, (ulong) ((double) iters * quot));
       if (s2 && n_is_prime(s2)) /* we probably should be more aggressive here */
       {
          fmpz_mul_ui(exponent, exponent, s2);
          for (j = 0; j < num_restarts; j++)
          {
             qfb_set(pow, restart[j].pow);
-            qfb_pow(pow, pow, n, exponent);
-            if (qfb_is_principal_form(pow, n))
+            qfb_pow_ctx(pow, pow, exponent, ctx);
+            if (qfb_is_principal_form_ctx(pow, ctx))
                break;
          }
          go_restart;
@@ -333,8 +321,21 @@ cleanup2:
    qfb_clear(oldpow);
    fmpz_clear(pow2);
    fmpz_clear(prod);
-   fmpz_clear(L);
    n_primes_clear(iter);
 
    return ret;
 }
+
+int qfb_exponent_element(fmpz_t exponent, qfb_t f, fmpz_t n, ulong B1, ulong B2_sqrt)
+{
+   qfb_ctx_t ctx;
+   int ret;
+
+   qfb_ctx_init(ctx, n);
+
+   ret = qfb_exponent_element_ctx(exponent, f, B1, B2_sqrt, ctx);
+
+   qfb_ctx_clear(ctx);
+
+   return ret;
+}
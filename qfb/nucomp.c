@@ -17,6 +17,7 @@
 
 #include <stdlib.h>
 #include <gmp.h>
+#include "flint/fmpz_vec.h"
 #include "qfb.h"
 
 /*
@@ -25,23 +26,26 @@
    forms of the algorithm presented in Appendix A of "Solving the
    Pell Equation", Michael Jacobson and High Williams, CMS Books in
    Mathematics, Springer 2009.
+
+   The generic version uses the first 22 integers at tmp as scratch space.
 */
-void qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g, fmpz_t D, fmpz_t L)
+void _qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g,
+                                       fmpz_t D, fmpz_t L, fmpz * tmp)
 {
-   fmpz_t a1, a2, c2, ca, cb, cc, k, s, sp, ss, m, t, u2, v1, v2;
+   fmpz * a1 = tmp + 0, * a2 = tmp + 1, * c2 = tmp + 2;
+   fmpz * ca = tmp + 3, * cb = tmp + 4, * cc = tmp + 5;
+   fmpz * k = tmp + 6, * s = tmp + 7, * sp = tmp + 8, * ss = tmp + 9;
+   fmpz * m = tmp + 10, * t = tmp + 11;
+   fmpz * u2 = tmp + 12, * v1 = tmp + 13, * v2 = tmp + 14;
+   fmpz * m1 = tmp + 15, * m2 = tmp + 16, * r1 = tmp + 17, * r2 = tmp + 18;
+   fmpz * co1 = tmp + 19, * co2 = tmp + 20, * temp = tmp + 21;
 
    if (fmpz_cmp(f->a, g->a) > 0)
    {
-      qfb_nucomp(r, g, f, D, L);
+      _qfb_nucomp(r, g, f, D, L, tmp);
       return;
    }
 
-   fmpz_init(a1); fmpz_init(a2); fmpz_init(c2);
-   fmpz_init(ca); fmpz_init(cb); fmpz_init(cc);
-   fmpz_init(k); fmpz_init(m);
-   fmpz_init(s); fmpz_init(sp); fmpz_init(ss);
-   fmpz_init(t); fmpz_init(u2); fmpz_init(v1); fmpz_init(v2);
-
    /* nucomp calculation */
 
    fmpz_set(a1, f->a);
@@ -99,11 +103,6 @@ void qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g, fmpz_t D, fmpz_t L)
       fmpz_divexact(cc, cc, a1);
    } else
    {
-      fmpz_t m1, m2, r1, r2, co1, co2, temp;
-
-      fmpz_init(m1); fmpz_init(m2); fmpz_init(r1); fmpz_init(r2);
-      fmpz_init(co1); fmpz_init(co2); fmpz_init(temp);
-
       fmpz_set(r2, a1);
       fmpz_set(r1, k);
 
@@ -144,18 +143,99 @@ void qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g, fmpz_t D, fmpz_t L)
          fmpz_neg(ca, ca);
          fmpz_neg(cc, cc);
       }
+   }
+
+   fmpz_swap(r->a, ca);
+   fmpz_swap(r->b, cb);
+   fmpz_swap(r->c, cc);
+}
+
+/*
+   Compose f and g using the word or double word size kernels if possible,
+   returning 1 if so. If reduce is set, the composition is also reduced
+   before conversion.
+*/
+static int
+qfb_nucomp_small(qfb_t r, const qfb_t f, const qfb_t g,
+                                       fmpz_t D, fmpz_t L, int reduce)
+{
+   if (_qfb_is_small(f, D) && _qfb_is_small(g, D))
+   {
+      qfb_small_t fs, gs;
+
+      qfb_small_set_qfb(fs, f);
+      qfb_small_set_qfb(gs, g);
+      qfb_small_nucomp(fs, fs, gs, fmpz_get_si(D), fmpz_get_si(L));
+      if (reduce)
+         qfb_small_reduce(fs, fs, fmpz_get_si(D));
+      qfb_set_qfb_small(r, fs);
 
-      fmpz_clear(m1); fmpz_clear(m2); fmpz_clear(r1); fmpz_clear(r2);
-      fmpz_clear(co1); fmpz_clear(co2); fmpz_clear(temp);
+      return 1;
+   }
+
+   if (_qfb_is_dsmall(f, D) && _qfb_is_dsmall(g, D))
+   {
+      qfb_dsmall_t fs, gs;
+      ulong Dd[2];
+
+      fmpz_get_signed_uiui(Dd + 1, Dd, D);
+      qfb_dsmall_set_qfb(fs, f);
+      qfb_dsmall_set_qfb(gs, g);
+      qfb_dsmall_nucomp(fs, fs, gs, Dd, fmpz_get_si(L));
+      if (reduce)
+         qfb_dsmall_reduce(fs, fs, Dd);
+      qfb_set_qfb_dsmall(r, fs);
+
+      return 1;
    }
 
-   fmpz_set(r->a, ca);
-   fmpz_set(r->b, cb);
-   fmpz_set(r->c, cc);
+   return 0;
+}
+
+void qfb_nucomp(qfb_t r, const qfb_t f, const qfb_t g, fmpz_t D, fmpz_t L)
+{
+   fmpz * tmp;
+
+   if (qfb_nucomp_small(r, f, g, D, L, 0))
+      return;
+
+   tmp = _fmpz_vec_init(QFB_CTX_TEMPS);
+
+   _qfb_nucomp(r, f, g, D, L, tmp);
+
+   _fmpz_vec_clear(tmp, QFB_CTX_TEMPS);
+}
+
+void qfb_nucomp_ctx(qfb_t r, const qfb_t f, const qfb_t g, qfb_ctx_t ctx)
+{
+   if (qfb_nucomp_small(r, f, g, ctx->D, ctx->L, 0))
+      return;
+
+   _qfb_nucomp(r, f, g, ctx->D, ctx->L, ctx->tmp);
+}
+
+void qfb_nucomp_reduce(qfb_t r, const qfb_t f, const qfb_t g,
+                                                   fmpz_t D, fmpz_t L)
+{
+   fmpz * tmp;
+
+   if (qfb_nucomp_small(r, f, g, D, L, 1))
+      return;
+
+   tmp = _fmpz_vec_init(QFB_CTX_TEMPS);
+
+   _qfb_nucomp(r, f, g, D, L, tmp);
+   _qfb_reduce(r, r, D, tmp);
+
+   _fmpz_vec_clear(tmp, QFB_CTX_TEMPS);
+}
+
+void qfb_nucomp_reduce_ctx(qfb_t r, const qfb_t f, const qfb_t g,
+                                                             qfb_ctx_t ctx)
+{
+   if (qfb_nucomp_small(r, f, g, ctx->D, ctx->L, 1))
+      return;
 
-   fmpz_clear(ca); fmpz_clear(cb); fmpz_clear(cc);
-   fmpz_clear(k); fmpz_clear(m);
-   fmpz_clear(s); fmpz_clear(sp); fmpz_clear(ss);
-   fmpz_clear(t); fmpz_clear(u2); fmpz_clear(v1); fmpz_clear(v2);
-   fmpz_clear(a1); fmpz_clear(a2); fmpz_clear(c2);
+   _qfb_nucomp(r, f, g, ctx->D, ctx->L, ctx->tmp);
+   _qfb_reduce(r, r, ctx->D, ctx->tmp);
 }
@@ -0,0 +1,186 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "flint/fmpz_vec.h"
+#include "qfb.h"
+
+static void
+qfb_nucube_gcdinv(fmpz_t d, fmpz_t a, fmpz_t t, const fmpz_t f, const fmpz_t g)
+{
+   if (fmpz_cmp(f, g) < 0)
+      fmpz_gcdinv(d, a, f, g);
+   else
+   {
+      fmpz_fdiv_r(t, f, g);
+      fmpz_gcdinv(d, a, t, g);
+   }
+}
+
+/*
+   Cubing is done as a NUDUPL without the partial reduction, followed by a
+   NUCOMP of the square with f. The square has a coefficient of size about
+   a^2, so the partial extended gcd is done on it and terminates at
+   sqrt(a1/a2)*L rather than L, see Imbert, Jacobson and Schmidt, "Fast
+   ideal cubing in imaginary quadratic number and function fields", Adv.
+   Math. Commun. 4 (2010), pp. 237--260.
+
+   The generic version uses the 24 integers at tmp as scratch space.
+*/
+void _qfb_nucube(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L, fmpz * tmp)
+{
+   fmpz * a1 = tmp + 0, * a2 = tmp + 1, * b1 = tmp + 2, * c2 = tmp + 3;
+   fmpz * ca = tmp + 4, * cb = tmp + 5, * cc = tmp + 6;
+   fmpz * k = tmp + 7, * m = tmp + 8;
+   fmpz * s = tmp + 9, * sp = tmp + 10, * ss = tmp + 11;
+   fmpz * t = tmp + 12, * u2 = tmp + 13, * v1 = tmp + 14, * v2 = tmp + 15;
+   fmpz * bound = tmp + 16;
+   fmpz * m1 = tmp + 17, * m2 = tmp + 18, * r1 = tmp + 19, * r2 = tmp + 20;
+   fmpz * co1 = tmp + 21, * co2 = tmp + 22, * temp = tmp + 23;
+
+   /* square of f without reduction, only its first two coefficients are needed */
+
+   if (fmpz_sgn(f->b) < 0)
+   {
+      fmpz_neg(b1, f->b);
+      qfb_nucube_gcdinv(s, v2, t, b1, f->a);
+      fmpz_neg(v2, v2);
+   } else
+      qfb_nucube_gcdinv(s, v2, t, f->b, f->a);
+
+   fmpz_divexact(a1, f->a, s);
+
+   fmpz_mul(k, v2, f->c);
+   fmpz_neg(k, k);
+   fmpz_fdiv_r(k, k, a1);
+
+   /* the square is (a1^2, b + 2m, ...) and ss = (b + b + 2m)/2 */
+   fmpz_mul(m, a1, k);
+   fmpz_add(ss, f->b, m);
+   fmpz_mul(a1, a1, a1);
+
+   /* nucomp of the square with f */
+
+   fmpz_set(a2, f->a);
+   fmpz_set(c2, f->c);
+
+   fmpz_fdiv_r(t, a2, a1);
+   if (fmpz_is_zero(t))
+   {
+      fmpz_set_ui(v1, 0);
+      fmpz_set(sp, a1);
+   } else
+      fmpz_gcdinv(sp, v1, t, a1);
+
+   fmpz_mul(k, m, v1);
+   fmpz_fdiv_r(k, k, a1);
+
+   if (!fmpz_is_one(sp))
+   {
+      fmpz_xgcd(s, v2, u2, ss, sp);
+
+      fmpz_mul(k, k, u2);
+      fmpz_mul(t, v2, c2);
+      fmpz_sub(k, k, t);
+
+      if (!fmpz_is_one(s))
+      {
+         fmpz_divexact(a1, a1, s);
+         fmpz_divexact(a2, a2, s);
+         fmpz_mul(c2, c2, s);
+      }
+
+      fmpz_fdiv_r(k, k, a1);
+   }
+
+   fmpz_tdiv_q(bound, a1, a2);
+   fmpz_sqrt(bound, bound);
+   fmpz_mul(bound, bound, L);
+
+   if (fmpz_cmp(a1, bound) < 0)
+   {
+      fmpz_mul(t, a2, k);
+
+      fmpz_mul(ca, a2, a1);
+
+      fmpz_mul_2exp(cb, t, 1);
+      fmpz_add(cb, cb, f->b);
+
+      fmpz_add(cc, f->b, t);
+      fmpz_mul(cc, cc, k);
+      fmpz_add(cc, cc, c2);
+
+      fmpz_divexact(cc, cc, a1);
+   } else
+   {
+      fmpz_set(r2, a1);
+      fmpz_set(r1, k);
+
+      fmpz_xgcd_partial(co2, co1, r2, r1, bound);
+
+      fmpz_mul(t, a2, r1);
+      fmpz_mul(m1, m, co1);
+      fmpz_add(m1, m1, t);
+      fmpz_divexact(m1, m1, a1);
+
+      fmpz_mul(m2, ss, r1);
+      fmpz_mul(temp, c2, co1);
+      fmpz_sub(m2, m2, temp);
+      fmpz_divexact(m2, m2, a1);
+
+      fmpz_mul(ca, r1, m1);
+      fmpz_mul(temp, co1, m2);
+      if (fmpz_sgn(co1) < 0)
+         fmpz_sub(ca, ca, temp);
+      else
+         fmpz_sub(ca, temp, ca);
+
+      fmpz_mul(cb, ca, co2);
+      fmpz_sub(cb, t, cb);
+      fmpz_mul_2exp(cb, cb, 1);
+      fmpz_divexact(cb, cb, co1);
+      fmpz_sub(cb, cb, f->b);
+      fmpz_mul_2exp(temp, ca, 1);
+      fmpz_fdiv_r(cb, cb, temp);
+
+      fmpz_mul(cc, cb, cb);
+      fmpz_sub(cc, cc, D);
+      fmpz_divexact(cc, cc, ca);
+      fmpz_fdiv_q_2exp(cc, cc, 2);
+
+      if (fmpz_sgn(ca) < 0)
+      {
+         fmpz_neg(ca, ca);
+         fmpz_neg(cc, cc);
+      }
+   }
+
+   fmpz_swap(r->a, ca);
+   fmpz_swap(r->b, cb);
+   fmpz_swap(r->c, cc);
+}
+
+void qfb_nucube(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
+{
+   fmpz * tmp = _fmpz_vec_init(QFB_CTX_TEMPS);
+
+   _qfb_nucube(r, f, D, L, tmp);
+
+   _fmpz_vec_clear(tmp, QFB_CTX_TEMPS);
+}
+
+void qfb_nucube_ctx(qfb_t r, const qfb_t f, qfb_ctx_t ctx)
+{
+   _qfb_nucube(r, f, ctx->D, ctx->L, ctx->tmp);
+}
@@ -20,6 +20,7 @@
 #include "flint/flint.h"
 #include "flint/ulong_extras.h"
 #include "flint/fmpz.h"
+#include "flint/fmpz_vec.h"
 #include "qfb.h"
 
 static void
@@ -34,15 +35,16 @@ qfb_nudupl_gcdinv(fmpz_t d, fmpz_t a, fmpz_t t, const fmpz_t f, const fmpz_t g)
    }
 }
 
-void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
+/*
+   The generic version uses the first 18 integers at tmp as scratch space.
+*/
+void _qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L, fmpz * tmp)
 {
-   fmpz_t a1, b1, c1, ca, cb, cc, k, s, t, u2, v1, v2;
-
-   fmpz_init(a1); fmpz_init(b1); fmpz_init(c1);
-   fmpz_init(ca); fmpz_init(cb); fmpz_init(cc);
-   fmpz_init(k);
-   fmpz_init(s);
-   fmpz_init(t); fmpz_init(u2); fmpz_init(v1); fmpz_init(v2);
+   fmpz * a1 = tmp + 0, * b1 = tmp + 1, * c1 = tmp + 2;
+   fmpz * ca = tmp + 3, * cb = tmp + 4, * cc = tmp + 5;
+   fmpz * k = tmp + 6, * s = tmp + 7, * t = tmp + 8, * v2 = tmp + 9;
+   fmpz * m2 = tmp + 10, * r1 = tmp + 11, * r2 = tmp + 12;
+   fmpz * co1 = tmp + 13, * co2 = tmp + 14, * temp = tmp + 15;
 
    /* nucomp calculation */
 
@@ -51,7 +53,7 @@ void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
 
    fmpz_zero(k);
 
-   if (fmpz_cmpabs(b1, a1) == 0)
+   if (fmpz_cmpabs(f->b, a1) == 0)
    {
       fmpz_set(s, a1);
       fmpz_zero(v2);
@@ -90,11 +92,6 @@ void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
       fmpz_divexact(cc, cc, a1);
    } else
    {
-      fmpz_t m2, r1, r2, co1, co2, temp;
-
-      fmpz_init(m2); fmpz_init(r1); fmpz_init(r2);
-      fmpz_init(co1); fmpz_init(co2); fmpz_init(temp);
-
       fmpz_set(r2, a1);
       fmpz_set(r1, k);
 
@@ -132,18 +129,65 @@ void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
          fmpz_neg(ca, ca);
          fmpz_neg(cc, cc);
       }
+   }
+
+   fmpz_swap(r->a, ca);
+   fmpz_swap(r->b, cb);
+   fmpz_swap(r->c, cc);
+}
 
-      fmpz_clear(m2); fmpz_clear(r1); fmpz_clear(r2);
-      fmpz_clear(co1); fmpz_clear(co2); fmpz_clear(temp);
+/*
+   Square f using the word or double word size kernels if possible,
+   returning 1 if so.
+*/
+static int
+qfb_nudupl_small(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
+{
+   if (_qfb_is_small(f, D))
+   {
+      qfb_small_t fs;
+
+      qfb_small_set_qfb(fs, f);
+      qfb_small_nudupl(fs, fs, fmpz_get_si(D), fmpz_get_si(L));
+      qfb_set_qfb_small(r, fs);
+
+      return 1;
    }
 
-   fmpz_set(r->a, ca);
-   fmpz_set(r->b, cb);
-   fmpz_set(r->c, cc);
+   if (_qfb_is_dsmall(f, D))
+   {
+      qfb_dsmall_t fs;
+      ulong Dd[2];
+
+      fmpz_get_signed_uiui(Dd + 1, Dd, D);
+      qfb_dsmall_set_qfb(fs, f);
+      qfb_dsmall_nudupl(fs, fs, Dd, fmpz_get_si(L));
+      qfb_set_qfb_dsmall(r, fs);
+
+      return 1;
+   }
+
+   return 0;
+}
+
+void qfb_nudupl(qfb_t r, const qfb_t f, fmpz_t D, fmpz_t L)
+{
+   fmpz * tmp;
+
+   if (qfb_nudupl_small(r, f, D, L))
+      return;
+
+   tmp = _fmpz_vec_init(QFB_CTX_TEMPS);
+
+   _qfb_nudupl(r, f, D, L, tmp);
+
+   _fmpz_vec_clear(tmp, QFB_CTX_TEMPS);
+}
+
+void qfb_nudupl_ctx(qfb_t r, const qfb_t f, qfb_ctx_t ctx)
+{
+   if (qfb_nudupl_small(r, f, ctx->D, ctx->L))
+      return;
 
-   fmpz_clear(ca); fmpz_clear(cb); fmpz_clear(cc);
-   fmpz_clear(k);
-   fmpz_clear(s);
-   fmpz_clear(t); fmpz_clear(u2); fmpz_clear(v2);
-   fmpz_clear(a1); fmpz_clear(b1); fmpz_clear(c1);
+   _qfb_nudupl(r, f, ctx->D, ctx->L, ctx->tmp);
 }
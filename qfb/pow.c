@@ -21,14 +21,14 @@
 #include "flint/fmpz.h"
 #include "qfb.h"
 
-void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e)
+void qfb_pow_ctx(qfb_t r, qfb_t f, const fmpz_t e, qfb_ctx_t ctx)
 {
-   fmpz_t L, exp;
-   qfb_t pow;
+   qfb * pow = ctx->q1;
+   ulong i, bits;
 
    if (fmpz_is_zero(e))
    {
-      qfb_principal_form(r, D);
+      qfb_principal_form_ctx(r, ctx);
       return;
    }
 
@@ -38,90 +38,65 @@ void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e)
       return;
    }
 
-   fmpz_init(L);
-   fmpz_init(exp);
-
-   fmpz_set(exp, e);
-
-   fmpz_abs(L, D);
-   fmpz_root(L, L, 4);
-
-   qfb_init(pow);
-   
-   qfb_set(pow, f);
-   while (fmpz_is_even(exp))
+   if (_qfb_is_small(f, ctx->D))
    {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      fmpz_fdiv_q_2exp(exp, exp, 1);
-   }
+      qfb_small_t fs;
 
-   qfb_set(r, pow);
-   fmpz_fdiv_q_2exp(exp, exp, 1);
-   
-   while (!fmpz_is_zero(exp))
-   {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      if (fmpz_is_odd(exp))
-      {
-         qfb_nucomp(r, r, pow, D, L);
-         qfb_reduce(r, r, D);
-      }
-      fmpz_fdiv_q_2exp(exp, exp, 1);
-   }
-
-   qfb_clear(pow);
-   fmpz_clear(L);
-   fmpz_clear(exp);
-}
+      qfb_small_set_qfb(fs, f);
+      qfb_small_pow(fs, fs, fmpz_get_si(ctx->D), e);
+      qfb_set_qfb_small(r, fs);
 
-void qfb_pow_with_root(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e, fmpz_t L)
-{
-   fmpz_t exp;
-   qfb_t pow;
-
-   if (fmpz_is_zero(e))
-   {
-      qfb_principal_form(r, D);
       return;
    }
 
-   if (fmpz_is_one(e))
+   if (_qfb_is_dsmall(f, ctx->D))
    {
-      qfb_set(r, f);
-      return;
-   }
+      qfb_dsmall_t fs;
+      ulong Dd[2];
 
-   fmpz_init(exp);
+      fmpz_get_signed_uiui(Dd + 1, Dd, ctx->D);
+      qfb_dsmall_set_qfb(fs, f);
+      qfb_dsmall_pow(fs, fs, Dd, e);
+      qfb_set_qfb_dsmall(r, fs);
 
-   fmpz_set(exp, e);
+      return;
+   }
 
-   qfb_init(pow);
-   
    qfb_set(pow, f);
-   while (fmpz_is_even(exp))
+   for (i = 0; !fmpz_tstbit(e, i); i++)
    {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      fmpz_fdiv_q_2exp(exp, exp, 1);
+      qfb_nudupl_ctx(pow, pow, ctx);
+      qfb_reduce_ctx(pow, pow, ctx);
    }
 
    qfb_set(r, pow);
-   fmpz_fdiv_q_2exp(exp, exp, 1);
-   
-   while (!fmpz_is_zero(exp))
+
+   bits = fmpz_bits(e);
+   for (i++; i < bits; i++)
    {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
-      if (fmpz_is_odd(exp))
+      qfb_nudupl_ctx(pow, pow, ctx);
+      qfb_reduce_ctx(pow, pow, ctx);
+      if (fmpz_tstbit(e, i))
       {
-         qfb_nucomp(r, r, pow, D, L);
-         qfb_reduce(r, r, D);
+         qfb_nucomp_reduce_ctx(r, r, pow, ctx);
       }
-      fmpz_fdiv_q_2exp(exp, exp, 1);
    }
+}
+
+void qfb_pow(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e)
+{
+   qfb_ctx_t ctx;
+
+   qfb_ctx_init(ctx, D);
+   qfb_pow_ctx(r, f, e, ctx);
+   qfb_ctx_clear(ctx);
+}
+
+void qfb_pow_with_root(qfb_t r, qfb_t f, fmpz_t D, fmpz_t e, fmpz_t L)
+{
+   qfb_ctx_t ctx;
 
-   qfb_clear(pow);
-   fmpz_clear(exp);
+   qfb_ctx_init_with_root(ctx, D, L);
+   qfb_pow_ctx(r, f, e, ctx);
+   qfb_ctx_clear(ctx);
 }
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+/*
+   There is no word size NUCUBE, so cubing is done by a NUDUPL followed by
+   a NUCOMP, which is still cheaper than the binary ladder on average. The
+   same goes for double words.
+*/
+static void
+qfb_small_pow_dbchain(qfb_small_t r, const qfb_small_t f, slong D,
+                                         const qfb_dbchain_t chain, slong L)
+{
+   qfb_small_t base, inv, t;
+   ulong j;
+   slong i;
+
+   *base = *f;
+   *inv = *f;
+   inv->b = -inv->b;
+
+   *r = *base;
+
+   for (i = 0; i < chain->length; i++)
+   {
+      if (chain->steps[i].sign != 0)
+      {
+         qfb_small_nucomp(r, r, chain->steps[i].sign > 0 ? base : inv, D, L);
+         qfb_small_reduce(r, r, D);
+      }
+
+      for (j = 0; j < chain->steps[i].pow3; j++)
+      {
+         qfb_small_nudupl(t, r, D, L);
+         qfb_small_reduce(t, t, D);
+         qfb_small_nucomp(r, r, t, D, L);
+         qfb_small_reduce(r, r, D);
+      }
+
+      for (j = 0; j < chain->steps[i].pow2; j++)
+      {
+         qfb_small_nudupl(r, r, D, L);
+         qfb_small_reduce(r, r, D);
+      }
+   }
+}
+
+static void
+qfb_dsmall_pow_dbchain(qfb_dsmall_t r, const qfb_dsmall_t f, const ulong * D,
+                                         const qfb_dbchain_t chain, slong L)
+{
+   qfb_dsmall_t base, inv, t;
+   ulong j;
+   slong i;
+
+   *base = *f;
+   *inv = *f;
+   _qfb_dw_neg(inv->b, inv->b);
+
+   *r = *base;
+
+   for (i = 0; i < chain->length; i++)
+   {
+      if (chain->steps[i].sign != 0)
+      {
+         qfb_dsmall_nucomp(r, r, chain->steps[i].sign > 0 ? base : inv, D, L);
+         qfb_dsmall_reduce(r, r, D);
+      }
+
+      for (j = 0; j < chain->steps[i].pow3; j++)
+      {
+         qfb_dsmall_nudupl(t, r, D, L);
+         qfb_dsmall_reduce(t, t, D);
+         qfb_dsmall_nucomp(r, r, t, D, L);
+         qfb_dsmall_reduce(r, r, D);
+      }
+
+      for (j = 0; j < chain->steps[i].pow2; j++)
+      {
+         qfb_dsmall_nudupl(r, r, D, L);
+         qfb_dsmall_reduce(r, r, D);
+      }
+   }
+}
+
+void qfb_pow_dbchain_ctx(qfb_t r, qfb_t f,
+                                    const qfb_dbchain_t chain, qfb_ctx_t ctx)
+{
+   qfb * base = ctx->q1, * inv = ctx->q2;
+   ulong j;
+   slong i;
+
+   if (chain->length == 0)
+   {
+      qfb_principal_form_ctx(r, ctx);
+      return;
+   }
+
+   if (_qfb_is_small(f, ctx->D))
+   {
+      qfb_small_t fs;
+
+      qfb_small_set_qfb(fs, f);
+      qfb_small_pow_dbchain(fs, fs, fmpz_get_si(ctx->D), chain,
+                                                      fmpz_get_si(ctx->L));
+      qfb_set_qfb_small(r, fs);
+
+      return;
+   }
+
+   if (_qfb_is_dsmall(f, ctx->D))
+   {
+      qfb_dsmall_t fs;
+      ulong Dd[2];
+
+      fmpz_get_signed_uiui(Dd + 1, Dd, ctx->D);
+      qfb_dsmall_set_qfb(fs, f);
+      qfb_dsmall_pow_dbchain(fs, fs, Dd, chain, fmpz_get_si(ctx->L));
+      qfb_set_qfb_dsmall(r, fs);
+
+      return;
+   }
+
+   qfb_set(base, f);
+   qfb_inverse(inv, f);
+
+   qfb_set(r, base);
+
+   for (i = 0; i < chain->length; i++)
+   {
+      if (chain->steps[i].sign != 0)
+      {
+         qfb_nucomp_reduce_ctx(r, r,
+                                 chain->steps[i].sign > 0 ? base : inv, ctx);
+      }
+
+      for (j = 0; j < chain->steps[i].pow3; j++)
+      {
+         qfb_nucube_ctx(r, r, ctx);
+         qfb_reduce_ctx(r, r, ctx);
+      }
+
+      for (j = 0; j < chain->steps[i].pow2; j++)
+      {
+         qfb_nudupl_ctx(r, r, ctx);
+         qfb_reduce_ctx(r, r, ctx);
+      }
+   }
+}
+
+void qfb_pow_dbchain(qfb_t r, qfb_t f, fmpz_t D,
+                                         const qfb_dbchain_t chain, fmpz_t L)
+{
+   qfb_ctx_t ctx;
+
+   qfb_ctx_init_with_root(ctx, D, L);
+   qfb_pow_dbchain_ctx(r, f, chain, ctx);
+   qfb_ctx_clear(ctx);
+}
@@ -0,0 +1,43 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint/flint.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void qfb_pow_fmpz(qfb_t r, qfb_t f, fmpz_t D, const fmpz_t e)
+{
+   qfb_ctx_t ctx;
+   qfb_dbchain_t chain;
+
+   if (fmpz_is_zero(e))
+   {
+      qfb_principal_form(r, D);
+      return;
+   }
+
+   if (fmpz_is_one(e))
+   {
+      qfb_set(r, f);
+      return;
+   }
+
+   qfb_ctx_init(ctx, D);
+   qfb_dbchain_init(chain);
+   qfb_dbchain_set_fmpz(chain, e);
+
+   qfb_pow_dbchain_ctx(r, f, chain, ctx);
+
+   qfb_dbchain_clear(chain);
+   qfb_ctx_clear(ctx);
+}
@@ -19,14 +19,13 @@
 #include "flint/fmpz.h"
 #include "qfb.h"
 
-void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
+void qfb_pow_ui_ctx(qfb_t r, qfb_t f, ulong exp, qfb_ctx_t ctx)
 {
-   fmpz_t L;
-   qfb_t pow;
+   qfb * pow = ctx->q1;
 
    if (exp == 0)
    {
-      qfb_principal_form(r, D);
+      qfb_principal_form_ctx(r, ctx);
       return;
    }
 
@@ -36,17 +35,35 @@ void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
       return;
    }
 
-   fmpz_init(L);
-   fmpz_abs(L, D);
-   fmpz_root(L, L, 4);
+   if (_qfb_is_small(f, ctx->D))
+   {
+      qfb_small_t fs;
+
+      qfb_small_set_qfb(fs, f);
+      qfb_small_pow_ui(fs, fs, fmpz_get_si(ctx->D), exp);
+      qfb_set_qfb_small(r, fs);
+
+      return;
+   }
+
+   if (_qfb_is_dsmall(f, ctx->D))
+   {
+      qfb_dsmall_t fs;
+      ulong Dd[2];
+
+      fmpz_get_signed_uiui(Dd + 1, Dd, ctx->D);
+      qfb_dsmall_set_qfb(fs, f);
+      qfb_dsmall_pow_ui(fs, fs, Dd, exp);
+      qfb_set_qfb_dsmall(r, fs);
+
+      return;
+   }
 
-   qfb_init(pow);
-   
    qfb_set(pow, f);
    while ((exp & 1) == 0)
    {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
+      qfb_nudupl_ctx(pow, pow, ctx);
+      qfb_reduce_ctx(pow, pow, ctx);
       exp >>= 1;
    }
 
@@ -55,16 +72,21 @@ void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
 
    while (exp)
    {
-      qfb_nudupl(pow, pow, D, L);
-      qfb_reduce(pow, pow, D);
+      qfb_nudupl_ctx(pow, pow, ctx);
+      qfb_reduce_ctx(pow, pow, ctx);
       if (exp & 1)
       {
-         qfb_nucomp(r, r, pow, D, L);
-         qfb_reduce(r, r, D);
+         qfb_nucomp_reduce_ctx(r, r, pow, ctx);
       }
       exp >>= 1;
    }
+}
+
+void qfb_pow_ui(qfb_t r, qfb_t f, fmpz_t D, ulong exp)
+{
+   qfb_ctx_t ctx;
 
-   qfb_clear(pow);
-   fmpz_clear(L);
+   qfb_ctx_init(ctx, D);
+   qfb_pow_ui_ctx(r, f, exp, ctx);
+   qfb_ctx_clear(ctx);
 }
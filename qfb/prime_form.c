@@ -99,3 +99,68 @@ void qfb_prime_form(qfb_t r, fmpz_t D, fmpz_t p)
    fmpz_clear(s);
    fmpz_clear(t);
 }
+
+/*
+   As per qfb_prime_form, but using d = D mod p from the context for the
+   common case of an odd prime not dividing D.
+*/
+static void _qfb_prime_form_mod(qfb_t r, ulong p, ulong d, qfb_ctx_t ctx)
+{
+   ulong t;
+
+   if (p == 2 || d == 0)
+   {
+      fmpz_set_ui(ctx->tmp, p);
+      qfb_prime_form(r, ctx->D, ctx->tmp);
+
+      return;
+   }
+
+   /* b is the square root of D mod p with the same parity as D */
+   t = n_sqrtmod(d, p);
+   if ((t & 1) != fmpz_is_odd(ctx->D))
+      t = p - t;
+
+   fmpz_set_ui(r->a, p);
+   fmpz_set_ui(r->b, t);
+   fmpz_mul_ui(r->c, r->b, t);
+   fmpz_sub(r->c, r->c, ctx->D);
+   fmpz_divexact_ui(r->c, r->c, p);
+   fmpz_fdiv_q_2exp(r->c, r->c, 2);
+}
+
+void qfb_prime_form_ctx(qfb_t r, ulong p, qfb_ctx_t ctx)
+{
+   slong lo, hi, mid;
+
+   qfb_ctx_precompute_primes(ctx);
+
+   /* look for p amongst the cached primes */
+   lo = 0;
+   hi = ctx->num_primes - 1;
+
+   while (lo <= hi)
+   {
+      mid = (lo + hi)/2;
+
+      if (ctx->primes[mid] == p)
+      {
+         qfb * f = ctx->prime_forms + mid;
+
+         if (fmpz_is_zero(f->a))
+            _qfb_prime_form_mod(f, p, ctx->Dmod[mid], ctx);
+
+         qfb_set(r, f);
+
+         return;
+      }
+
+      if (ctx->primes[mid] < p)
+         lo = mid + 1;
+      else
+         hi = mid - 1;
+   }
+
+   fmpz_set_ui(ctx->tmp, p);
+   qfb_prime_form(r, ctx->D, ctx->tmp);
+}
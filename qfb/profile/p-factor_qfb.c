@@ -23,18 +23,17 @@
 
 int main(void)
 {
-   fmpz_t g, n, n0, p, L;
+   fmpz_t g, n, n0;
    slong iters, i, j, depth, jmax = 10;
    qfb_t pow, twopow;
    ulong pr, nmodpr, mult, n0mod4;
    qfb_hash_t * qhash;
+   qfb_ctx_t ctx;
    int done;
 
    fmpz_init(g);
    fmpz_init(n);
    fmpz_init(n0);
-   fmpz_init(p);
-   fmpz_init(L);
 
    qfb_init(pow);
    qfb_init(twopow);
@@ -78,8 +77,7 @@ int main(void)
             fmpz_mul_2exp(n, n, 2);
 
          pr = 2;
-         fmpz_abs(L, n);
-         fmpz_root(L, L, 4);
+         qfb_ctx_init(ctx, n);
 
          do
          {
@@ -96,35 +94,33 @@ int main(void)
             }
          } while (n_jacobi(nmodpr, pr) < 0);
 
-         fmpz_set_ui(p, pr);
-
          /* find prime form of discriminant n */
-         qfb_prime_form(pow, n, p);
+         qfb_prime_form_ctx(pow, pr, ctx);
    
          /* raise to various powers of small primes */
-         qfb_pow_ui(pow, pow, n, 59049); /* 3^10 */
-         qfb_pow_ui(twopow, pow, n, 4096);
-         if (qfb_is_principal_form(twopow, n))
+         qfb_pow_ui_ctx(pow, pow, 59049, ctx); /* 3^10 */
+         qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+         if (qfb_is_principal_form_ctx(twopow, ctx))
             goto done;
 
-         qfb_pow_ui(pow, pow, n, 390625); /* 5^8 */
-         qfb_pow_ui(twopow, pow, n, 4096);
-         if (qfb_is_principal_form(twopow, n))
+         qfb_pow_ui_ctx(pow, pow, 390625, ctx); /* 5^8 */
+         qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+         if (qfb_is_principal_form_ctx(twopow, ctx))
             goto done;
 
-         qfb_pow_ui(pow, pow, n, 117649); /* 7^6 */
-         qfb_pow_ui(twopow, pow, n, 4096);
-         if (qfb_is_principal_form(twopow, n))
+         qfb_pow_ui_ctx(pow, pow, 117649, ctx); /* 7^6 */
+         qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+         if (qfb_is_principal_form_ctx(twopow, ctx))
             goto done;
 
-         qfb_pow_ui(pow, pow, n, 14641); /* 11^4 */
-         qfb_pow_ui(twopow, pow, n, 4096);
-         if (qfb_is_principal_form(twopow, n))
+         qfb_pow_ui_ctx(pow, pow, 14641, ctx); /* 11^4 */
+         qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+         if (qfb_is_principal_form_ctx(twopow, ctx))
             goto done;
 
-         qfb_pow_ui(pow, pow, n, 169); /* 13^2 */
-         qfb_pow_ui(twopow, pow, n, 4096);
-         if (qfb_is_principal_form(twopow, n))
+         qfb_pow_ui_ctx(pow, pow, 169, ctx); /* 13^2 */
+         qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+         if (qfb_is_principal_form_ctx(twopow, ctx))
             goto done;
 
          depth = FLINT_BIT_COUNT(iters) + 1;
@@ -134,9 +130,9 @@ int main(void)
          for (i = 0; i < iters; i++)
          {
             pr = n_nextprime(pr, 0);
-            qfb_pow_ui(pow, pow, n, pr*pr);
-            qfb_pow_ui(twopow, pow, n, 4096);
-            if (qfb_is_principal_form(twopow, n)) /* found factor */
+            qfb_pow_ui_ctx(pow, pow, pr*pr, ctx);
+            qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+            if (qfb_is_principal_form_ctx(twopow, ctx)) /* found factor */
                break;
             qfb_hash_insert(qhash, twopow, pow, i, depth);
          }
@@ -148,9 +144,9 @@ int main(void)
       
             for (i = 0; i < iters; i++)
             {
-               qfb_pow_ui(pow, pow, n, jump);
-               qfb_pow_ui(twopow, pow, n, 4096);
-               if (qfb_is_principal_form(twopow, n)) /* found factor */
+               qfb_pow_ui_ctx(pow, pow, jump, ctx);
+               qfb_pow_ui_ctx(twopow, pow, 4096, ctx);
+               if (qfb_is_principal_form_ctx(twopow, ctx)) /* found factor */
                   break;
                iters2 = qfb_hash_find(qhash, twopow, depth); 
                if (iters2 != -1) /* found factor */
@@ -158,8 +154,7 @@ int main(void)
                   if (fmpz_sgn(qhash[iters2].q->b) == fmpz_sgn(twopow->b))
                      qfb_inverse(qhash[iters2].q2, qhash[iters2].q2);
 
-                  qfb_nucomp(pow, pow, qhash[iters2].q2, n, L);
-                  qfb_reduce(pow, pow, n);
+                  qfb_nucomp_reduce_ctx(pow, pow, qhash[iters2].q2, ctx);
 
                   break;
                }
@@ -174,8 +169,8 @@ done:
          {
             for (i = 0; i < 12; i++)
             {
-               qfb_pow_ui(twopow, pow, n, 2);
-               if (qfb_is_principal_form(twopow, n))
+               qfb_pow_ui_ctx(twopow, pow, 2, ctx);
+               if (qfb_is_principal_form_ctx(twopow, ctx))
                {
                   if (fmpz_cmpabs(pow->a, pow->b) != 0)
                   {
@@ -204,6 +199,7 @@ done:
          mult += 2;
 
          qfb_hash_clear(qhash, depth);
+         qfb_ctx_clear(ctx);
 
       }
 
@@ -220,8 +216,6 @@ done:
    fmpz_clear(g);
    fmpz_clear(n);
    fmpz_clear(n0);
-   fmpz_clear(p);
-   fmpz_clear(L);
 
    return 0;
 }
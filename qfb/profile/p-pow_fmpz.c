@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qfb.h"
+
+#define NUM 100
+
+typedef struct
+{
+   slong dbits;
+   slong ebits;
+   int chain;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   slong dbits = info->dbits, ebits = info->ebits, i, j;
+   int chain = info->chain;
+   fmpz_t D, L, e;
+   qfb_t f, r;
+   qfb_dbchain_t C;
+
+   flint_rand_t state;
+   flint_randinit(state);
+
+   fmpz_init(D);
+   fmpz_init(L);
+   fmpz_init(e);
+   qfb_init(f);
+   qfb_init(r);
+   qfb_dbchain_init(C);
+
+   for (i = 0; i < count; i++)
+   {
+      do
+      {
+         fmpz_randtest_unsigned(f->a, state, dbits/2);
+         if (fmpz_is_zero(f->a))
+            fmpz_set_ui(f->a, 1);
+
+         fmpz_randtest(f->b, state, dbits/2);
+         fmpz_randtest(f->c, state, dbits/2);
+
+         qfb_discriminant(D, f);
+      } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+      fmpz_abs(L, D);
+      fmpz_root(L, L, 4);
+
+      qfb_reduce(f, f, D);
+
+      fmpz_randbits(e, state, ebits);
+      fmpz_abs(e, e);
+
+      if (chain)
+         qfb_dbchain_set_fmpz(C, e);
+
+      prof_start();
+      for (j = 0; j < NUM; j++)
+      {
+         if (chain)
+            qfb_pow_dbchain(r, f, D, C, L);
+         else
+            qfb_pow_with_root(r, f, D, e, L);
+      }
+      prof_stop();
+   }
+
+   qfb_dbchain_clear(C);
+   qfb_clear(f);
+   qfb_clear(r);
+   fmpz_clear(D);
+   fmpz_clear(L);
+   fmpz_clear(e);
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   slong k;
+
+   printf("Powering of binary quadratic forms\n");
+
+   for (k = 64; k <= 1024; k *= 2)
+   {
+      info.dbits = k;
+      info.ebits = 256;
+
+      info.chain = 0;
+      prof_repeat(&min, &max, sample, (void *) &info);
+      flint_printf("binary : D bits %wd, exp bits %wd, min %.3e us, max %.3e us\n",
+           info.dbits, info.ebits, min/NUM, max/NUM);
+
+      info.chain = 1;
+      prof_repeat(&min, &max, sample, (void *) &info);
+      flint_printf("dbchain: D bits %wd, exp bits %wd, min %.3e us, max %.3e us\n",
+           info.dbits, info.ebits, min/NUM, max/NUM);
+   }
+
+   return 0;
+}
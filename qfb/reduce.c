@@ -18,46 +18,229 @@
 #include <gmp.h>
 #include "qfb.h"
 
-void qfb_reduce(qfb_t r, qfb_t f, fmpz_t D)
+#define QFB_REDUCE_LIMIT (WORD(1) << (FLINT_BITS/2 - 2))
+#define QFB_REDUCE_HALF (WORD(1) << (FLINT_BITS/2 - 1))
+
+/*
+   Reduce f using the word or double word size kernels if possible,
+   returning 1 if so. For the latter, a, b and c must leave room for 2a
+   and -b in a signed double word.
+*/
+static int
+qfb_reduce_small(qfb_t r, qfb_t f, fmpz_t D)
+{
+   if (qfb_small_fits(D) && fmpz_sgn(f->a) > 0 && !COEFF_IS_MPZ(*f->a)
+                         && !COEFF_IS_MPZ(*f->b) && !COEFF_IS_MPZ(*f->c))
+   {
+      qfb_small_t s;
+
+      qfb_small_set_qfb(s, f);
+      qfb_small_reduce(s, s, fmpz_get_si(D));
+      qfb_set_qfb_small(r, s);
+
+      return 1;
+   }
+
+   if (qfb_dsmall_fits(D) && fmpz_sgn(f->a) > 0
+                          && fmpz_bits(f->a) <= 2*FLINT_BITS - 2
+                          && fmpz_bits(f->b) <= 2*FLINT_BITS - 2
+                          && fmpz_bits(f->c) <= 2*FLINT_BITS - 2)
+   {
+      qfb_dsmall_t s;
+      ulong Dd[2];
+
+      fmpz_get_signed_uiui(Dd + 1, Dd, D);
+      qfb_dsmall_set_qfb(s, f);
+      qfb_dsmall_reduce(s, s, Dd);
+      qfb_set_qfb_dsmall(r, s);
+
+      return 1;
+   }
+
+   return 0;
+}
+
+/*
+   Lehmer style reduction step for a form r which is far from reduced. The
+   reduction steps are applied to the leading FLINT_BITS - 2 bits of a, b
+   and c, accumulating the transformation [u v; w x] in single words, which
+   is then applied to r in one go. As the leading bits only approximate r,
+   the result need not be what exact reduction steps would give, but it is
+   always equivalent to r. Returns 0 if no progress could be made, in which
+   case r is unchanged. Uses the first 4 integers at tmp as scratch space.
+*/
+static int
+_qfb_reduce_lehmer(qfb_t r, fmpz_t D, fmpz * tmp)
 {
-   int done = 0;
-   fmpz_t t;
+   fmpz * na = tmp + 0, * nb = tmp + 1, * nc = tmp + 2, * t = tmp + 3;
+   slong u = 1, v = 0, w = 0, x = 1;
+   slong a0, b0, c0, r0, k, h, nv, nx;
+   slong s, steps = 0;
+   ulong hi, lo;
+
+   if (fmpz_bits(r->a) <= (fmpz_bits(D) + 1)/2 + FLINT_BITS/2)
+      return 0;
+
+   s = FLINT_MAX(fmpz_bits(r->a), fmpz_bits(r->b));
+   s = FLINT_MAX(s, fmpz_bits(r->c)) - (FLINT_BITS - 2);
+   if (s <= 0)
+      return 0;
+
+   fmpz_fdiv_q_2exp(t, r->a, s);
+   a0 = fmpz_get_si(t);
+   fmpz_fdiv_q_2exp(t, r->b, s);
+   b0 = fmpz_get_si(t);
+   fmpz_fdiv_q_2exp(t, r->c, s);
+   c0 = fmpz_get_si(t);
+
+   if (a0 < QFB_REDUCE_HALF)
+      return 0;
+
+   /* stop as soon as the approximation is too poor to be useful */
+   while (c0 >= QFB_REDUCE_HALF)
+   {
+      if (FLINT_ABS(b0) > a0)
+      {
+         r0 = b0 % (2*a0);
+         if (r0 < 0)
+            r0 += 2*a0;
+         if (r0 > a0)
+            r0 -= 2*a0;
+         k = (b0 - r0)/(2*a0);
+
+         if (FLINT_ABS(k) >= QFB_REDUCE_LIMIT)
+            break;
+
+         nv = v - k*u;
+         nx = x - k*w;
+         if (FLINT_ABS(nv) >= QFB_REDUCE_LIMIT
+          || FLINT_ABS(nx) >= QFB_REDUCE_LIMIT)
+            break;
+
+         /* c0 -= k*(b0 - k*a0), where k*(b0 - k*a0) >= 0 */
+         h = b0 - k*a0;
+         smul_ppmm(hi, lo, k, h);
+         if (hi != 0 || (slong) lo < 0)
+            break;
+
+         c0 -= (slong) lo;
+         b0 = r0;
+         v = nv;
+         x = nx;
+      } else if (c0 < a0)
+      {
+         h = a0;
+         a0 = c0;
+         c0 = h;
+         b0 = -b0;
+
+         h = u;
+         u = v;
+         v = -h;
+         h = w;
+         w = x;
+         x = -h;
+      } else
+         break;
+
+      steps++;
+   }
+
+   if (steps == 0)
+      return 0;
+
+   /* (a, b, c) -> (a u^2 + b u w + c w^2, ..., a v^2 + b v x + c x^2) */
+   fmpz_mul_si(na, r->a, u*u);
+   fmpz_mul_si(t, r->b, u*w);
+   fmpz_add(na, na, t);
+   fmpz_mul_si(t, r->c, w*w);
+   fmpz_add(na, na, t);
+
+   if (fmpz_cmp(na, r->a) >= 0)
+      return 0;
+
+   fmpz_mul_si(nb, r->a, 2*u*v);
+   fmpz_mul_si(t, r->b, u*x + v*w);
+   fmpz_add(nb, nb, t);
+   fmpz_mul_si(t, r->c, 2*w*x);
+   fmpz_add(nb, nb, t);
+
+   fmpz_mul_si(nc, r->a, v*v);
+   fmpz_mul_si(t, r->b, v*x);
+   fmpz_add(nc, nc, t);
+   fmpz_mul_si(t, r->c, x*x);
+   fmpz_add(nc, nc, t);
+
+   fmpz_swap(r->a, na);
+   fmpz_swap(r->b, nb);
+   fmpz_swap(r->c, nc);
+
+   return 1;
+}
+
+/*
+   The generic version uses the first 4 integers at tmp as scratch space.
+   Rather than recomputing c from the discriminant after each normalisation,
+   it is updated as c - k*(b + b')/2 where b' = b - 2ka.
+*/
+void _qfb_reduce(qfb_t r, qfb_t f, fmpz_t D, fmpz * tmp)
+{
+   fmpz * k = tmp + 0, * t = tmp + 1;
 
    qfb_set(r, f);
-   
-   fmpz_init(t);
 
-   while(!done)
+   while (1)
    {
-      done = 1;
+      if (_qfb_reduce_lehmer(r, D, tmp))
+         continue;
 
       if (fmpz_cmp(r->c, r->a) < 0)
       {
          fmpz_swap(r->a, r->c);
          fmpz_neg(r->b, r->b);
-
-         done = 0;
-      }
-
-      if (fmpz_cmpabs(r->b, r->a) > 0)
+      } else if (fmpz_cmpabs(r->b, r->a) > 0)
       {
          fmpz_add(t, r->a, r->a);
-         fmpz_fdiv_r(r->b, r->b, t);
+         fmpz_fdiv_qr(k, r->b, r->b, t);
          if (fmpz_cmp(r->b, r->a) > 0)
+         {
             fmpz_sub(r->b, r->b, t);
-
-         fmpz_add(t, t, t);
-         fmpz_mul(r->c, r->b, r->b);
-         fmpz_sub(r->c, r->c, D);
-         fmpz_divexact(r->c, r->c, t);
-
-         done = 0;
-      }
+            fmpz_add_ui(k, k, 1);
+         }
+
+         fmpz_mul(t, k, r->a);
+         fmpz_add(t, t, r->b);
+         fmpz_submul(r->c, k, t);
+      } else
+         break;
    }
 
    if (fmpz_cmpabs(r->a, r->b) == 0 || fmpz_cmp(r->a, r->c) == 0)
       if (fmpz_sgn(r->b) < 0)
          fmpz_neg(r->b, r->b);
+}
+
+void qfb_reduce(qfb_t r, qfb_t f, fmpz_t D)
+{
+   fmpz tmp[4];
+   slong i;
+
+   if (qfb_reduce_small(r, f, D))
+      return;
+
+   for (i = 0; i < 4; i++)
+      fmpz_init(tmp + i);
+
+   _qfb_reduce(r, f, D, tmp);
+
+   for (i = 0; i < 4; i++)
+      fmpz_clear(tmp + i);
+}
+
+void qfb_reduce_ctx(qfb_t r, qfb_t f, qfb_ctx_t ctx)
+{
+   if (qfb_reduce_small(r, f, ctx->D))
+      return;
 
-   fmpz_clear(t);
+   _qfb_reduce(r, f, ctx->D, ctx->tmp);
 }
@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "qfb.h"
+
+/*
+   As per qfb_nucomp. For reduced f and g with |D| < 2^QFB_SMALL_BITS all
+   intermediate quantities are bounded by |D| in absolute value, except
+   for cb^2 - D which is computed in a double word.
+*/
+void qfb_small_nucomp(qfb_small_t r, const qfb_small_t f,
+                                       const qfb_small_t g, slong D, slong L)
+{
+   slong a1, a2, c2, ca, cb, cc, k, m, s, sp, ss, t, u2, v2;
+   ulong v1;
+
+   if (f->a > g->a)
+   {
+      qfb_small_nucomp(r, g, f, D, L);
+      return;
+   }
+
+   a1 = f->a;
+   a2 = g->a;
+   c2 = g->c;
+
+   /* b values of forms of the same discriminant have the same parity */
+   ss = (f->b + g->b)/2;
+   m = (f->b - g->b)/2;
+
+   t = a2 % a1;
+   if (t == 0)
+   {
+      v1 = 0;
+      sp = a1;
+   } else
+      sp = n_gcdinv(&v1, t, a1);
+
+   k = (m*(slong) v1) % a1;
+
+   if (sp != 1)
+   {
+      s = _qfb_small_xgcd(&v2, &u2, ss, sp);
+
+      k = k*u2 - v2*c2;
+
+      if (s != 1)
+      {
+         a1 /= s;
+         a2 /= s;
+         c2 *= s;
+      }
+
+      k %= a1;
+   }
+
+   if (k < 0)
+      k += a1;
+
+   if (a1 < L)
+   {
+      t = a2*k;
+
+      ca = a2*a1;
+      cb = 2*t + g->b;
+      cc = ((g->b + t)*k + c2)/a1;
+   } else
+   {
+      slong m1, m2, r1, r2, co1, co2;
+
+      r2 = a1;
+      r1 = k;
+
+      _qfb_small_xgcd_partial(&co2, &co1, &r2, &r1, L);
+
+      t = a2*r1;
+      m1 = (m*co1 + t)/a1;
+      m2 = (ss*r1 - c2*co1)/a1;
+
+      if (co1 < 0)
+         ca = r1*m1 - co1*m2;
+      else
+         ca = co1*m2 - r1*m1;
+
+      cb = (2*(t - ca*co2))/co1 - g->b;
+
+      /* reduce cb modulo 2ca, with the sign of 2ca */
+      t = 2*ca;
+      cb %= t;
+      if (cb != 0 && (cb < 0) != (t < 0))
+         cb += t;
+
+      ca = FLINT_ABS(ca);
+      cc = _qfb_small_c(ca, cb, D);
+   }
+
+   r->a = ca;
+   r->b = cb;
+   r->c = cc;
+}
@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "qfb.h"
+
+/*
+   As per qfb_nudupl. For reduced f with |D| < 2^QFB_SMALL_BITS all
+   intermediate quantities are bounded by |D| in absolute value, except
+   for cb^2 - D which is computed in a double word.
+*/
+void qfb_small_nudupl(qfb_small_t r, const qfb_small_t f, slong D, slong L)
+{
+   slong a1, c1, ca, cb, cc, k, s, t;
+   ulong v2;
+
+   a1 = f->a;
+
+   t = FLINT_ABS(f->b) % a1;
+   if (t == 0)
+   {
+      s = a1;
+      v2 = 0;
+   } else
+      s = n_gcdinv(&v2, t, a1);
+
+   c1 = f->c;
+
+   if (s != 1)
+   {
+      a1 /= s;
+      c1 *= s;
+   }
+
+   /* k = -v2*c mod a1, where v2*b = s mod a */
+   k = ((slong) (v2 % a1)*(f->c % a1)) % a1;
+   if (f->b >= 0)
+      k = -k;
+   if (k < 0)
+      k += a1;
+
+   if (a1 < L)
+   {
+      t = a1*k;
+
+      ca = a1*a1;
+      cb = 2*t + f->b;
+      cc = ((f->b + t)*k + c1)/a1;
+   } else
+   {
+      slong m2, r1, r2, co1, co2;
+
+      r2 = a1;
+      r1 = k;
+
+      _qfb_small_xgcd_partial(&co2, &co1, &r2, &r1, L);
+
+      t = a1*r1;
+      m2 = (f->b*r1 - c1*co1)/a1;
+
+      if (co1 < 0)
+         ca = r1*r1 - co1*m2;
+      else
+         ca = co1*m2 - r1*r1;
+
+      cb = (2*(t - ca*co2))/co1 - f->b;
+
+      /* reduce cb modulo 2ca, with the sign of 2ca */
+      t = 2*ca;
+      cb %= t;
+      if (cb != 0 && (cb < 0) != (t < 0))
+         cb += t;
+
+      ca = FLINT_ABS(ca);
+      cc = _qfb_small_c(ca, cb, D);
+   }
+
+   r->a = ca;
+   r->b = cb;
+   r->c = cc;
+}
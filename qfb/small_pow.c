@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "flint/fmpz.h"
+#include "qfb.h"
+
+void qfb_small_pow(qfb_small_t r, const qfb_small_t f, slong D,
+                                                              const fmpz_t e)
+{
+   slong L, i, bits;
+   qfb_small_t pow;
+
+   if (fmpz_is_zero(e))
+   {
+      qfb_small_principal_form(r, D);
+      return;
+   }
+
+   L = n_root(-D, 4);
+   bits = fmpz_bits(e);
+
+   *pow = *f;
+
+   for (i = 0; !fmpz_tstbit(e, i); i++)
+   {
+      qfb_small_nudupl(pow, pow, D, L);
+      qfb_small_reduce(pow, pow, D);
+   }
+
+   *r = *pow;
+
+   for (i++; i < bits; i++)
+   {
+      qfb_small_nudupl(pow, pow, D, L);
+      qfb_small_reduce(pow, pow, D);
+      if (fmpz_tstbit(e, i))
+      {
+         qfb_small_nucomp(r, r, pow, D, L);
+         qfb_small_reduce(r, r, D);
+      }
+   }
+}
@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "flint/ulong_extras.h"
+#include "qfb.h"
+
+void qfb_small_pow_ui(qfb_small_t r, const qfb_small_t f, slong D, ulong exp)
+{
+   slong L;
+   qfb_small_t pow;
+
+   if (exp == 0)
+   {
+      qfb_small_principal_form(r, D);
+      return;
+   }
+
+   L = n_root(-D, 4);
+
+   *pow = *f;
+
+   while ((exp & 1) == 0)
+   {
+      qfb_small_nudupl(pow, pow, D, L);
+      qfb_small_reduce(pow, pow, D);
+      exp >>= 1;
+   }
+
+   *r = *pow;
+   exp >>= 1;
+
+   while (exp)
+   {
+      qfb_small_nudupl(pow, pow, D, L);
+      qfb_small_reduce(pow, pow, D);
+      if (exp & 1)
+      {
+         qfb_small_nucomp(r, r, pow, D, L);
+         qfb_small_reduce(r, r, D);
+      }
+      exp >>= 1;
+   }
+}
@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include "qfb.h"
+
+void qfb_small_reduce(qfb_small_t r, const qfb_small_t f, slong D)
+{
+   slong a = f->a, b = f->b, c = f->c, t;
+   int done = 0;
+
+   while (!done)
+   {
+      done = 1;
+
+      if (c < a)
+      {
+         t = a;
+         a = c;
+         c = t;
+         b = -b;
+
+         done = 0;
+      }
+
+      if (FLINT_ABS(b) > a)
+      {
+         t = 2*a;
+         b %= t;
+         if (b < 0)
+            b += t;
+         if (b > a)
+            b -= t;
+
+         c = _qfb_small_c(a, b, D);
+
+         done = 0;
+      }
+   }
+
+   if (FLINT_ABS(b) == a || a == c)
+      if (b < 0)
+         b = -b;
+
+   r->a = a;
+   r->b = b;
+   r->c = c;
+}
@@ -0,0 +1,101 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint/fmpz_vec.h"
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i;
+
+    printf("dsmall_nucomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 10000; i++) 
+    {
+        fmpz_t D, L;
+        fmpz * tmp;
+        qfb_t f, g, r, s, t;
+        qfb_dsmall_t fs, gs, rs;
+        ulong Dd[2];
+
+        fmpz_init(D);
+        fmpz_init(L);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+        qfb_init(s);
+        qfb_init(t);
+        tmp = _fmpz_vec_init(QFB_CTX_TEMPS);
+
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, (QFB_DSMALL_BITS - 3)/2);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, (QFB_DSMALL_BITS - 3)/2);
+           fmpz_randtest(f->c, state, (QFB_DSMALL_BITS - 3)/2);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(f, f, D);
+        qfb_pow_ui(g, f, D, n_randint(state, 1000));
+
+        fmpz_get_signed_uiui(Dd + 1, Dd, D);
+        qfb_dsmall_set_qfb(fs, f);
+        qfb_dsmall_set_qfb(gs, g);
+        qfb_dsmall_nucomp(rs, fs, gs, Dd, fmpz_get_si(L));
+        qfb_dsmall_reduce(rs, rs, Dd);
+        qfb_set_qfb_dsmall(r, rs);
+
+        /* the generic code, without dispatch to the kernels */
+        _qfb_nucomp(s, f, g, D, L, tmp);
+        _qfb_reduce(s, s, D, tmp);
+
+        qfb_nucomp_reduce(t, f, g, D, L);
+
+        result = (qfb_equal(r, s) && qfb_equal(t, s));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           printf("t = "); qfb_print(t); printf("\n");
+           abort();
+        }
+
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+        qfb_clear(s);
+        qfb_clear(t);
+        _fmpz_vec_clear(tmp, QFB_CTX_TEMPS);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
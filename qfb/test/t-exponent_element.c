@@ -77,6 +77,22 @@ int main(void)
               }
 
               result = (fmpz_cmp(exp1, exp2) == 0);
+
+              /* the same with a context, which is not changed by the call */
+              if (result)
+              {
+                 qfb_ctx_t ctx;
+
+                 qfb_ctx_init(ctx, D);
+
+                 result = qfb_exponent_element_ctx(exp2, forms + i1, 
+                                                    1000000, 100000, ctx)
+                       && fmpz_cmp(exp1, exp2) == 0
+                       && fmpz_equal(ctx->D, D);
+
+                 qfb_ctx_clear(ctx);
+              }
+
               if (!result)
               {
                  printf("FAIL:\n");
@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i, j;
+
+    printf("nucomp_ctx....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* one context reused for many operations, with aliasing */
+    for (i = 0; i < 200; i++) 
+    {
+        fmpz_t D, L;
+        qfb_t f, g, r, s;
+        qfb_ctx_t ctx;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+        qfb_init(s);
+            
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, 200);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, 200);
+           fmpz_randtest(f->c, state, 200);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(f, f, D);
+        qfb_set(g, f);
+
+        qfb_ctx_init(ctx, D);
+
+        for (j = 0; j < 20; j++)
+        {
+           qfb_nucomp(r, f, g, D, L);
+           qfb_reduce(r, r, D);
+           qfb_set(s, f);
+           qfb_nucomp_ctx(s, s, g, ctx);
+           qfb_reduce_ctx(s, s, ctx);
+
+           result = (qfb_equal(r, s));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("qfb_nucomp_ctx does not agree with qfb_nucomp\n");
+              printf("f = "); qfb_print(f); printf("\n");
+              printf("g = "); qfb_print(g); printf("\n");
+              qfb_print(r); printf(" != "); qfb_print(s);
+              abort();
+           }
+
+           qfb_nudupl(r, g, D, L);
+           qfb_reduce(r, r, D);
+           qfb_nudupl_ctx(s, g, ctx);
+           qfb_reduce_ctx(s, s, ctx);
+
+           result = (qfb_equal(r, s));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("qfb_nudupl_ctx does not agree with qfb_nudupl\n");
+              printf("g = "); qfb_print(g); printf("\n");
+              qfb_print(r); printf(" != "); qfb_print(s);
+              abort();
+           }
+
+           qfb_nucube(r, g, D, L);
+           qfb_reduce(r, r, D);
+           qfb_nucube_ctx(s, g, ctx);
+           qfb_reduce_ctx(s, s, ctx);
+
+           result = (qfb_equal(r, s));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("qfb_nucube_ctx does not agree with qfb_nucube\n");
+              printf("g = "); qfb_print(g); printf("\n");
+              qfb_print(r); printf(" != "); qfb_print(s);
+              abort();
+           }
+
+           /* move on to g*f */
+           qfb_nucomp_ctx(g, g, f, ctx);
+           qfb_reduce_ctx(g, g, ctx);
+        }
+
+        qfb_ctx_clear(ctx);
+         
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
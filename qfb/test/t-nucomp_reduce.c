@@ -0,0 +1,105 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i;
+
+    printf("nucomp_reduce....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 2000; i++) 
+    {
+        fmpz_t D, L;
+        qfb_t f, g, r, s;
+        qfb_ctx_t ctx;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+        qfb_init(s);
+
+        /* exercise both the word size and the generic code */
+        do
+        {
+           slong bits = n_randint(state, 2) ? 25 : 200;
+
+           fmpz_randtest_unsigned(f->a, state, bits);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, bits);
+           fmpz_randtest(f->c, state, bits);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(f, f, D);
+        qfb_pow_ui(g, f, D, n_randint(state, 1000));
+
+        qfb_nucomp(r, f, g, D, L);
+        qfb_reduce(r, r, D);
+        qfb_nucomp_reduce(s, f, g, D, L);
+
+        result = (qfb_equal(r, s));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           abort();
+        }
+
+        qfb_ctx_init(ctx, D);
+
+        qfb_set(s, g);
+        qfb_nucomp_reduce_ctx(s, f, s, ctx);
+
+        result = (qfb_equal(r, s));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("qfb_nucomp_reduce_ctx does not agree with qfb_nucomp\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           abort();
+        }
+
+        qfb_ctx_clear(ctx);
+
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
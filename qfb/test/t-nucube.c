@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    qfb * forms;
+    slong i, k, i1, num;
+
+    printf("nucube....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* small discriminants, all reduced forms */
+    for (i = 1; i < 10000; i++) 
+    {
+        qfb_t r, s;
+        fmpz_t root, D;
+
+        num = qfb_reduced_forms(&forms, -i);
+        
+        if (num)
+        {
+           fmpz_init(root);
+           fmpz_init(D);
+           qfb_init(r);
+           qfb_init(s);
+              
+           fmpz_set_ui(root, i);
+           fmpz_root(root, root, 4);
+
+           for (k = 0; k < 20; k++)
+           {
+              i1 = n_randint(state, num);
+              
+              qfb_discriminant(D, forms + i1);
+
+              qfb_nudupl(r, forms + i1, D, root);
+              qfb_reduce(r, r, D);
+              qfb_nucomp(r, r, forms + i1, D, root);
+              qfb_nucube(s, forms + i1, D, root);
+              qfb_reduce(r, r, D);
+              qfb_reduce(s, s, D);
+
+              result = (qfb_equal(r, s));
+              if (!result)
+              {
+                 printf("FAIL:\n");
+                 printf("NUCUBE does not agree with NUDUPL and NUCOMP\n");
+                 printf("f = "); qfb_print(forms + i1); printf("\n");
+                 qfb_print(r); printf(" != "); qfb_print(s);
+                 abort();
+              }
+           }
+           
+           fmpz_clear(D);
+           fmpz_clear(root);
+           qfb_clear(r);
+           qfb_clear(s);
+        }
+
+        qfb_array_clear(&forms, num);
+    }
+
+    /* large discriminants, aliasing */
+    for (i = 0; i < 1000; i++) 
+    {
+        fmpz_t D, L;
+        qfb_t f, r, s;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        qfb_init(f);
+        qfb_init(r);
+        qfb_init(s);
+            
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, 200);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, 200);
+           fmpz_randtest(f->c, state, 200);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(f, f, D);
+
+        qfb_nucomp(r, f, f, D, L);
+        qfb_reduce(r, r, D);
+        qfb_nucomp(r, r, f, D, L);
+        qfb_reduce(r, r, D);
+
+        qfb_set(s, f);
+        qfb_nucube(s, s, D, L);
+        qfb_reduce(s, s, D);
+
+        result = (qfb_equal(r, s));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("NUCUBE does not agree with NUCOMP (aliasing)\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(s);
+           abort();
+        }
+         
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(f);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
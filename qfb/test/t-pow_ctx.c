@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i, j;
+
+    printf("pow_ctx....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 200; i++) 
+    {
+        fmpz_t D, e1, e2;
+        qfb_t f, r, s, t;
+        qfb_ctx_t ctx;
+        ulong exp;
+
+        fmpz_init(D);
+        fmpz_init(e1);
+        fmpz_init(e2);
+        qfb_init(f);
+        qfb_init(r);
+        qfb_init(s);
+        qfb_init(t);
+            
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, 150);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, 150);
+           fmpz_randtest(f->c, state, 150);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        qfb_reduce(f, f, D);
+
+        qfb_ctx_init(ctx, D);
+
+        for (j = 0; j < 10; j++)
+        {
+           /* f^e1 * f^e2 = f^(e1 + e2) */
+           fmpz_randtest_unsigned(e1, state, 100);
+           fmpz_randtest_unsigned(e2, state, 100);
+
+           qfb_pow_ctx(r, f, e1, ctx);
+           qfb_pow_ctx(s, f, e2, ctx);
+           qfb_nucomp_ctx(r, r, s, ctx);
+           qfb_reduce_ctx(r, r, ctx);
+
+           fmpz_add(e1, e1, e2);
+           qfb_set(s, f);
+           qfb_pow_ctx(s, s, e1, ctx);
+
+           result = (qfb_equal(r, s));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("f^e1 * f^e2 != f^(e1 + e2)\n");
+              printf("f = "); qfb_print(f); printf("\n");
+              printf("e1 + e2 = "); fmpz_print(e1); printf("\n");
+              qfb_print(r); printf(" != "); qfb_print(s);
+              abort();
+           }
+
+           /* qfb_pow_ui_ctx agrees with qfb_pow */
+           exp = n_randtest(state);
+           fmpz_set_ui(e1, exp);
+
+           qfb_pow(r, f, D, e1);
+           qfb_pow_ui_ctx(t, f, exp, ctx);
+
+           result = (qfb_equal(r, t));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("qfb_pow_ui_ctx does not agree with qfb_pow\n");
+              printf("f = "); qfb_print(f); printf("\n");
+              printf("exp = %lu\n", exp);
+              qfb_print(r); printf(" != "); qfb_print(t);
+              abort();
+           }
+        }
+
+        qfb_ctx_clear(ctx);
+         
+        fmpz_clear(D);
+        fmpz_clear(e1);
+        fmpz_clear(e2);
+        qfb_clear(f);
+        qfb_clear(r);
+        qfb_clear(s);
+        qfb_clear(t);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i, j;
+
+    printf("pow_fmpz....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with repeated composition */
+    for (i = 1; i < 1000; i++) 
+    {
+        fmpz_t D, L, fexp;
+        qfb_t r, s, t;
+        ulong exp;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        fmpz_init(fexp);
+        qfb_init(r);
+        qfb_init(s);
+        qfb_init(t);
+            
+        do
+        {
+           fmpz_randtest_unsigned(r->a, state, 100);
+           if (fmpz_is_zero(r->a))
+              fmpz_set_ui(r->a, 1);
+ 
+           fmpz_randtest(r->b, state, 100);
+           fmpz_randtest(r->c, state, 100);
+
+           qfb_discriminant(D, r);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(r));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(r, r, D);
+           
+        exp = n_randint(state, 1000);
+
+        fmpz_set_ui(fexp, exp);
+        qfb_pow_fmpz(s, r, D, fexp);
+        qfb_reduce(s, s, D);
+
+        qfb_principal_form(t, D);
+        for (j = 0; j < exp; j++)
+        {
+           qfb_nucomp(t, t, r, D, L);
+           qfb_reduce(t, t, D);
+        }
+
+        result = (qfb_equal(s, t));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("exp = %lu\n", exp);
+           qfb_print(r); printf("\n");
+           qfb_print(s); printf("\n");
+           qfb_print(t); printf("\n");
+           abort();
+        }
+         
+        fmpz_clear(fexp);
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(r);
+        qfb_clear(s);
+        qfb_clear(t);
+    }
+
+    /* compare with qfb_pow for large exponents, reusing the chain */
+    for (i = 1; i < 100; i++) 
+    {
+        fmpz_t D, L, fexp;
+        qfb_t r, s, t;
+        qfb_dbchain_t chain;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        fmpz_init(fexp);
+        qfb_init(r);
+        qfb_init(s);
+        qfb_init(t);
+        qfb_dbchain_init(chain);
+
+        fmpz_randtest_unsigned(fexp, state, 300);
+        qfb_dbchain_set_fmpz(chain, fexp);
+
+        for (j = 0; j < 10; j++)
+        {
+           do
+           {
+              fmpz_randtest_unsigned(r->a, state, 100);
+              if (fmpz_is_zero(r->a))
+                 fmpz_set_ui(r->a, 1);
+ 
+              fmpz_randtest(r->b, state, 100);
+              fmpz_randtest(r->c, state, 100);
+
+              qfb_discriminant(D, r);
+           } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(r));
+
+           fmpz_abs(L, D);
+           fmpz_root(L, L, 4);
+
+           qfb_reduce(r, r, D);
+
+           qfb_pow(t, r, D, fexp);
+           qfb_reduce(t, t, D);
+
+           qfb_pow_dbchain(s, r, D, chain, L);
+           qfb_reduce(s, s, D);
+
+           result = (qfb_equal(s, t));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("exp = "); fmpz_print(fexp); printf("\n");
+              qfb_print(r); printf("\n");
+              qfb_print(s); printf("\n");
+              qfb_print(t); printf("\n");
+              abort();
+           }
+
+           /* aliasing */
+           qfb_pow_fmpz(r, r, D, fexp);
+           qfb_reduce(r, r, D);
+
+           result = (qfb_equal(r, t));
+           if (!result)
+           {
+              printf("FAIL (aliasing):\n");
+              printf("exp = "); fmpz_print(fexp); printf("\n");
+              qfb_print(r); printf("\n");
+              qfb_print(t); printf("\n");
+              abort();
+           }
+        }
+
+        qfb_dbchain_clear(chain);
+        fmpz_clear(fexp);
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(r);
+        qfb_clear(s);
+        qfb_clear(t);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i, j, k;
+    
+    printf("prime_form_ctx....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 1; i < 2000; i++) 
+    {
+        fmpz_t D, p;
+        qfb_t r, s;
+        qfb_ctx_t ctx;
+        ulong n, q, Dmodp;
+        
+        fmpz_init(D);
+        fmpz_init(p);
+        qfb_init(r);
+        qfb_init(s);
+            
+        do
+        {
+           fmpz_randtest_unsigned(r->a, state, 100);
+           if (fmpz_is_zero(r->a))
+              fmpz_set_ui(r->a, 1);
+ 
+           fmpz_randtest(r->b, state, 100);
+           fmpz_randtest(r->c, state, 100);
+
+           qfb_discriminant(D, r);
+        } while (fmpz_sgn(D) >= 0);
+
+        qfb_ctx_init(ctx, D);
+
+        qfb_principal_form(r, D);
+        qfb_principal_form_ctx(s, ctx);
+
+        result = (qfb_equal(r, s) && qfb_is_principal_form_ctx(s, ctx));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("principal form is wrong\n");
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           printf("D = \n"); fmpz_print(D); printf("\n");
+           abort();
+        }
+
+        /* small primes are cached, so ask for them more than once */
+        for (j = 0; j < 30; j++)
+        {
+           do
+           {
+              if (n_randint(state, 4) == 0)
+                 n = n_randprime(state, n_randint(state, FLINT_BITS - 1) + 2, 0);
+              else
+                 n = n_nth_prime(n_randint(state, QFB_CTX_PRIMES) + 1);
+              Dmodp = fmpz_fdiv_ui(D, n);
+           } while ((mp_limb_signed_t) Dmodp < 0 /* Jacobi can't handle this */
+            || (n == 2 && ((q = fmpz_fdiv_ui(D, 8)) == 2 || q == 3 || q == 5))
+            || (n != 2 && Dmodp != 0 && n_jacobi(Dmodp, n) < 0));
+
+           fmpz_set_ui(p, n);
+           qfb_prime_form(r, D, p);
+           qfb_prime_form_ctx(s, n, ctx);
+
+           result = qfb_equal(r, s);
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("qfb_prime_form_ctx does not agree with qfb_prime_form\n");
+              qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+              printf("p = %lu\n", n);
+              printf("D = \n"); fmpz_print(D); printf("\n");
+              abort();
+           }
+        }
+
+        for (k = 0; k < ctx->num_primes; k++)
+        {
+           result = (ctx->Dmod[k] == fmpz_fdiv_ui(D, ctx->primes[k]));
+           if (!result)
+           {
+              printf("FAIL:\n");
+              printf("D mod %lu is wrong\n", ctx->primes[k]);
+              printf("D = \n"); fmpz_print(D); printf("\n");
+              abort();
+           }
+        }
+           
+        qfb_ctx_clear(ctx);
+
+        fmpz_clear(D);
+        fmpz_clear(p);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -63,6 +63,69 @@ int main(void)
         qfb_clear(r);
     }
 
+    /* forms far from reduced */
+    for (i = 1; i < 10000; i++) 
+    {
+        fmpz_t D, k, t;
+        qfb_t f, g, r;
+        slong j;
+        
+        fmpz_init(D);
+        fmpz_init(k);
+        fmpz_init(t);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+            
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, 200);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, 200);
+           fmpz_randtest(f->c, state, 200);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0);
+
+        qfb_reduce(f, f, D);
+
+        /* apply random (a, b, c) -> (a, b + 2ka, c + kb + k^2a), (c, -b, a) */
+        qfb_set(g, f);
+        for (j = n_randint(state, 20); j >= 0; j--)
+        {
+           fmpz_randtest(k, state, 40);
+
+           fmpz_mul(t, k, g->a);
+           fmpz_add(t, t, g->b);
+           fmpz_addmul(g->c, k, t);
+           fmpz_addmul(g->b, k, g->a);
+           fmpz_addmul(g->b, k, g->a);
+
+           fmpz_swap(g->a, g->c);
+           fmpz_neg(g->b, g->b);
+        }
+
+        qfb_reduce(r, g, D);
+
+        result = (qfb_equal(r, f));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(f); printf("\n");
+           abort();
+        }
+           
+        fmpz_clear(D);
+        fmpz_clear(k);
+        fmpz_clear(t);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+    }
+
     flint_randclear(state);
     _fmpz_cleanup();
     printf("PASS\n");
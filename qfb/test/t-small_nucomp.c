@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+/* (a, b, c) -> (a, b + 2a, a + b + c), not reduced if f is reduced */
+static void shift_form(qfb_t r, qfb_t f)
+{
+   fmpz_add(r->c, f->c, f->a);
+   fmpz_add(r->c, r->c, f->b);
+   fmpz_add(r->b, f->b, f->a);
+   fmpz_add(r->b, r->b, f->a);
+   fmpz_set(r->a, f->a);
+}
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i;
+
+    printf("small_nucomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 10000; i++) 
+    {
+        fmpz_t D, L;
+        qfb_t f, g, r, s;
+        qfb_small_t fs, gs, rs;
+
+        fmpz_init(D);
+        fmpz_init(L);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(r);
+        qfb_init(s);
+
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, (QFB_SMALL_BITS - 3)/2);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, (QFB_SMALL_BITS - 3)/2);
+           fmpz_randtest(f->c, state, (QFB_SMALL_BITS - 3)/2);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        fmpz_abs(L, D);
+        fmpz_root(L, L, 4);
+
+        qfb_reduce(f, f, D);
+        qfb_pow_ui(g, f, D, n_randint(state, 1000));
+
+        qfb_small_set_qfb(fs, f);
+        qfb_small_set_qfb(gs, g);
+        qfb_small_nucomp(rs, fs, gs, fmpz_get_si(D), fmpz_get_si(L));
+        qfb_small_reduce(rs, rs, fmpz_get_si(D));
+        qfb_set_qfb_small(r, rs);
+
+        /* compose forms which are not reduced, so that the generic code is used */
+        shift_form(f, f);
+        shift_form(g, g);
+        qfb_nucomp(s, f, g, D, L);
+        qfb_reduce(s, s, D);
+
+        result = (qfb_equal(r, s));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           abort();
+        }
+
+        fmpz_clear(D);
+        fmpz_clear(L);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
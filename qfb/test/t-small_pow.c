@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+/* (a, b, c) -> (a, b + 2a, a + b + c), not reduced if f is reduced */
+static void shift_form(qfb_t r, qfb_t f)
+{
+   fmpz_add(r->c, f->c, f->a);
+   fmpz_add(r->c, r->c, f->b);
+   fmpz_add(r->b, f->b, f->a);
+   fmpz_add(r->b, r->b, f->a);
+   fmpz_set(r->a, f->a);
+}
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i;
+
+    printf("small_pow....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 10000; i++) 
+    {
+        fmpz_t D, e;
+        qfb_t f, r, s;
+        qfb_small_t fs, rs, ss;
+        ulong exp;
+
+        fmpz_init(D);
+        fmpz_init(e);
+        qfb_init(f);
+        qfb_init(r);
+        qfb_init(s);
+
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, (QFB_SMALL_BITS - 3)/2);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, (QFB_SMALL_BITS - 3)/2);
+           fmpz_randtest(f->c, state, (QFB_SMALL_BITS - 3)/2);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        qfb_reduce(f, f, D);
+
+        exp = n_randtest(state);
+        fmpz_set_ui(e, exp);
+
+        qfb_small_set_qfb(fs, f);
+        qfb_small_pow_ui(rs, fs, fmpz_get_si(D), exp);
+        qfb_small_pow(ss, fs, fmpz_get_si(D), e);
+        qfb_set_qfb_small(r, rs);
+
+        /* the generic ladder, starting from a form which is not reduced */
+        shift_form(f, f);
+        qfb_pow(s, f, D, e);
+        qfb_reduce(s, s, D);
+
+        result = (qfb_equal(r, s) && rs->a == ss->a && rs->b == ss->b
+                                                    && rs->c == ss->c);
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("exp = %lu\n", exp);
+           qfb_print(r); printf(" != "); qfb_print(s); printf("\n");
+           abort();
+        }
+
+        fmpz_clear(D);
+        fmpz_clear(e);
+        qfb_clear(f);
+        qfb_clear(r);
+        qfb_clear(s);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
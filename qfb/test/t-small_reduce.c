@@ -0,0 +1,114 @@
+/*=============================================================================
+
+    This file is part of Antic.
+
+    Antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version. See <http://www.gnu.org/licenses/>.
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "qfb.h"
+
+int main(void)
+{
+    int result;
+    flint_rand_t state;
+    slong i, j;
+
+    printf("small_reduce....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 10000; i++) 
+    {
+        fmpz_t D, D2, n, t;
+        qfb_t f, g, h;
+        qfb_small_t s;
+
+        fmpz_init(D);
+        fmpz_init(D2);
+        fmpz_init(n);
+        fmpz_init(t);
+        qfb_init(f);
+        qfb_init(g);
+        qfb_init(h);
+
+        do
+        {
+           fmpz_randtest_unsigned(f->a, state, (QFB_SMALL_BITS - 3)/2);
+           if (fmpz_is_zero(f->a))
+              fmpz_set_ui(f->a, 1);
+ 
+           fmpz_randtest(f->b, state, (QFB_SMALL_BITS - 3)/2);
+           fmpz_randtest(f->c, state, (QFB_SMALL_BITS - 3)/2);
+
+           qfb_discriminant(D, f);
+        } while (fmpz_sgn(D) >= 0 || !qfb_is_primitive(f));
+
+        qfb_reduce(f, f, D);
+
+        /* apply random unimodular transformations to f */
+        qfb_set(g, f);
+        for (j = n_randint(state, 6); j >= 0; j--)
+        {
+           if (n_randint(state, 2))
+           {
+              /* (a, b, c) -> (c, -b, a) */
+              fmpz_swap(g->a, g->c);
+              fmpz_neg(g->b, g->b);
+           } else
+           {
+              /* (a, b, c) -> (a, b + 2an, an^2 + bn + c) */
+              fmpz_randtest(n, state, 10);
+              fmpz_mul(t, g->a, n);
+              fmpz_add(t, t, g->b);
+              fmpz_mul(t, t, n);
+              fmpz_add(h->c, g->c, t);
+              fmpz_mul(t, g->a, n);
+              fmpz_mul_2exp(t, t, 1);
+              fmpz_add(h->b, g->b, t);
+              fmpz_set(h->a, g->a);
+           
+              if (COEFF_IS_MPZ(*h->a) || COEFF_IS_MPZ(*h->b)
+                                      || COEFF_IS_MPZ(*h->c))
+                 break;
+
+              qfb_set(g, h);
+           }
+        }
+
+        qfb_discriminant(D2, g);
+
+        qfb_small_set_qfb(s, g);
+        qfb_small_reduce(s, s, fmpz_get_si(D));
+        qfb_set_qfb_small(h, s);
+
+        result = (fmpz_equal(D, D2) && qfb_is_reduced(h) && qfb_equal(h, f));
+        if (!result)
+        {
+           printf("FAIL:\n");
+           printf("f = "); qfb_print(f); printf("\n");
+           printf("g = "); qfb_print(g); printf("\n");
+           printf("h = "); qfb_print(h); printf("\n");
+           abort();
+        }
+
+        fmpz_clear(D);
+        fmpz_clear(D2);
+        fmpz_clear(n);
+        fmpz_clear(t);
+        qfb_clear(f);
+        qfb_clear(g);
+        qfb_clear(h);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}